@@ -302,6 +302,15 @@ $(TEST): all
 	@echo ======================================================
 	@(./run_tests -j $(MOOSE_JOBS))
 
+# Run the scalability benchmarks (see scripts/benchmarks.py) with the executable of this application,
+# which must include the modules.  Options for the driver are passed in BENCHMARK_OPTIONS, e.g.
+#   make benchmarks BENCHMARK_OPTIONS="--scaling weak --procs 1 2 4 8 --json run.json --compare last.json"
+benchmarks: all
+	@echo ======================================================
+	@echo Benchmarking $(CURRENT_APP)
+	@echo ======================================================
+	@$(MOOSE_DIR)/scripts/benchmarks.py --executable $(APPLICATION_DIR)/$(APPLICATION_NAME)-$(METHOD) $(BENCHMARK_OPTIONS)
+
 # Build appliations up the tree
 up:
 	@echo ======================================================
@@ -361,7 +370,7 @@ libmesh_update:
 #
 # Maintenance
 #
-.PHONY: cleanall clean doc sa test up test_up test_only_up clean_up
+.PHONY: cleanall clean doc sa test benchmarks up test_up test_only_up clean_up
 
 #
 # Misc
@@ -31,6 +31,13 @@ public:
   bool completeSetup(MooseMesh *mesh);
 
   virtual void act() override;
+
+protected:
+  /**
+   * The number of refinements left to the grid sequencing, from Executioner/num_grids: the mesh
+   * is refined that many levels less than requested with Mesh/uniform_refine.
+   */
+  unsigned int numGridSteps();
 };
 
 #endif // SETUPMESHCOMPLETEACTION_H
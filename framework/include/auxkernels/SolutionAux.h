@@ -67,6 +67,15 @@ protected:
 
   /// Additional factor added to the solution, the b of ax+b
   const Real _add_factor;
+
+  /// Flag for caching the evaluation of each element in the SolutionUserObject
+  const bool _fixed_mesh;
+
+  /// Storage for the point passed to SolutionUserObject::pointValues()
+  std::vector<Point> _centroid;
+
+  /// Storage for the value returned by SolutionUserObject::pointValues()
+  std::vector<Real> _centroid_value;
 };
 
 #endif //SOLUTIONAUX_H
@@ -142,16 +142,18 @@ public:
   /**
    * Performs uniform refinement of the passed Mesh object. The
    * number of levels of refinement performed is stored in the
-   * MooseMesh object. No solution projection is performed in this
-   * version.
+   * MooseMesh object, unless a number of levels is passed. No
+   * solution projection is performed in this version.
    */
-  static void uniformRefine(MooseMesh *mesh);
+  static void uniformRefine(MooseMesh *mesh, unsigned int level = libMesh::invalid_uint);
 
   /**
    * Performs uniform refinement on the meshes in the current
    * object. Projections are performed of the solution vectors.
+   * The number of levels is the one stored in the MooseMesh
+   * object, unless a number of levels is passed.
    */
-  void uniformRefineWithProjection();
+  void uniformRefineWithProjection(unsigned int level = libMesh::invalid_uint);
 
   /**
    * Is adaptivity on?
@@ -195,6 +197,14 @@ public:
    */
   void setMaxHLevel(unsigned int level) { _max_h_level = level; }
 
+  /**
+   * Set the load imbalance (the largest number of active elements on a processor divided by the
+   * mean) above which the mesh is repartitioned after it is adapted.  Below it the children stay
+   * on the processor of their parent, which avoids the repartitioning and the redistribution of
+   * the mesh.  A threshold of zero (the default) repartitions after every adaptivity step.
+   */
+  void setRepartitionThreshold(Real threshold) { _repartition_threshold = threshold; }
+
   /**
    * Set the interval (number of timesteps) between refinement steps.
    */
@@ -211,7 +221,18 @@ public:
   ErrorVector & getErrorVector(const std::string & indicator_field);
 
   /**
-   * Update the ErrorVectors that have been requested through calls to getErrorVector().
+   * Get the smallest and largest entries of the ErrorVector of an indicator field over the
+   * whole mesh (the entries of the ids that are not active elements are zero), as computed by
+   * updateErrorVectors().
+   *
+   * @param indicator_field The name of the field to get the range of the ErrorVector for.
+   */
+  const std::pair<Real, Real> & getErrorVectorRange(const std::string & indicator_field);
+
+  /**
+   * Update the ErrorVectors that have been requested through calls to getErrorVector().  Only
+   * the entries of the local elements are filled, the ranges of the vectors over the whole mesh
+   * are computed with a single collective.
    */
   void updateErrorVectors();
 
@@ -274,8 +295,20 @@ protected:
   /// Whether or not to recompute markers during adaptivity cycles
   bool _recompute_markers_during_cycles;
 
+  /// The load imbalance above which the adapted mesh is repartitioned, zero to always repartition
+  Real _repartition_threshold;
+
+  /**
+   * Repartition the mesh (and the displaced mesh), which was adapted without repartitioning,
+   * if its load imbalance is above _repartition_threshold.
+   */
+  void repartitionIfImbalanced();
+
   /// Stores pointers to ErrorVectors associated with indicator field names
   std::map<std::string, std::unique_ptr<ErrorVector> > _indicator_field_to_error_vector;
+
+  /// The smallest and largest entries of the ErrorVectors of each indicator field name
+  std::map<std::string, std::pair<Real, Real> > _indicator_field_to_error_range;
 };
 
 template<typename T>
@@ -25,6 +25,9 @@
 #include "libmesh/fe_base.h"
 #include "libmesh/enum_quadrature_type.h"
 
+// C++
+#include <tuple>
+
 // MOOSE Forward Declares
 class MooseMesh;
 class ArbitraryQuadrature;
@@ -341,6 +344,33 @@ public:
    */
   void useFECache(bool fe_cache) { _should_use_fe_cache = fe_cache; }
 
+  /**
+   * Whether or not this assembly should reuse the volume shape functions and JxW computed on an
+   * element for the elements that are translated copies of it (a geometry cache rather than the
+   * per-element cache of useFECache()).  Only the quadrature points are recomputed, by
+   * translation, so the libMesh FE objects keep the values of the element the data was computed
+   * on.  The cache is only used if all variables are LAGRANGE, L2_LAGRANGE, MONOMIAL or SCALAR,
+   * whose shape functions do not depend on the global node numbering, and not with XFEM or
+   * the per-element cache.
+   *
+   * @param fe_geometry_cache True for using the cache false for not.
+   */
+  void useFEGeometryCache(bool fe_geometry_cache);
+
+  /**
+   * Whether or not the volume shape functions and JxW of each element are computed once, on the
+   * element of reference_mesh with the same id, and mapped to the current element with the
+   * deformation gradient at each quadrature point instead of reiniting the FE objects.  Meant for
+   * the Assembly of the displaced problem: the mapping is exact (not a small strain approximation)
+   * since both meshes share the LAGRANGE geometric basis.  Only used under the same conditions as
+   * the geometry cache, without second derivatives and on elements of the mesh dimension; it
+   * stores the reference data of every element, like useFECache().  Also clears that data, so it
+   * must be called again when reference_mesh changes.
+   *
+   * @param reference_mesh The undisplaced mesh, NULL to turn the cache off
+   */
+  void useReferenceGeometryCache(const MooseMesh * reference_mesh);
+
   void prepare();
   void prepareNonlocal();
 
@@ -379,6 +409,12 @@ public:
    */
   void cacheResidualContribution(dof_id_type dof, Real value, Moose::KernelType type);
 
+  ///@{
+  /// The residual contributions cached since the last call to addCachedResidual()
+  const std::vector<Real> & cachedResidualValues(Moose::KernelType type) const { return _cached_residual_values[type]; }
+  const std::vector<dof_id_type> & cachedResidualRows(Moose::KernelType type) const { return _cached_residual_rows[type]; }
+  ///@}
+
   /**
    * Lets an external class cache residual at a set of nodes
    */
@@ -400,6 +436,12 @@ public:
   void setResidualNeighbor(NumericVector<Number> & residual, Moose::KernelType type = Moose::KT_NONTIME);
 
   void addJacobian(SparseMatrix<Number> & jacobian);
+
+  /**
+   * Add the element Jacobian blocks of the row of variable ivar, as one dense matrix over the
+   * columns of all the coupled variables.
+   */
+  void addJacobianRow(SparseMatrix<Number> & jacobian, MooseVariable & ivar);
   void addJacobianNonlocal(SparseMatrix<Number> & jacobian);
   void addJacobianBlock(SparseMatrix<Number> & jacobian, unsigned int ivar, unsigned int jvar, const DofMap & dof_map, std::vector<dof_id_type> & dof_indices);
   void addJacobianBlockNonlocal(SparseMatrix<Number> & jacobian, unsigned int ivar, unsigned int jvar, const DofMap & dof_map, const std::vector<dof_id_type> & idof_indices, const std::vector<dof_id_type> & jdof_indices);
@@ -430,7 +472,11 @@ public:
    */
   void addCachedJacobian(SparseMatrix<Number> & jacobian);
 
-  DenseVector<Number> & residualBlock(unsigned int var_num, Moose::KernelType type = Moose::KT_NONTIME) { return _sub_Re[static_cast<unsigned int>(type)][var_num]; }
+  DenseVector<Number> & residualBlock(unsigned int var_num, Moose::KernelType type = Moose::KT_NONTIME)
+  {
+    _sub_Re_used[static_cast<unsigned int>(type)][var_num] = 1;
+    return _sub_Re[static_cast<unsigned int>(type)][var_num];
+  }
   DenseVector<Number> & residualBlockNeighbor(unsigned int var_num, Moose::KernelType type = Moose::KT_NONTIME) { return _sub_Rn[static_cast<unsigned int>(type)][var_num]; }
 
   DenseMatrix<Number> & jacobianBlock(unsigned int ivar, unsigned int jvar);
@@ -514,6 +560,31 @@ protected:
    */
   void reinitFE(const Elem * elem);
 
+  /**
+   * Reinit the volume FE objects, or reuse the data cached for a translated copy of the element.
+   *
+   * @param elem The element we are using to reinit
+   */
+  void reinitFECongruent(const Elem * elem);
+
+  /**
+   * Reinit the volume FE quantities by mapping the data cached on the reference element.
+   *
+   * @param elem The element we are using to reinit
+   * @return false if the element cannot use the reference geometry cache, nothing is reinited then
+   */
+  bool reinitFEReference(const Elem * elem);
+
+  /**
+   * Delete the data in the geometry cache
+   */
+  void clearCongruentCache();
+
+  /**
+   * Delete the data in the reference geometry cache
+   */
+  void clearReferenceCache();
+
   /**
    * Just an internal helper function to reinit the face FE objects.
    *
@@ -543,6 +614,12 @@ protected:
 
   void setResidualBlock(NumericVector<Number> & residual, DenseVector<Number> & res_block, std::vector<dof_id_type> & dof_indices, Real scaling_factor);
 
+  /**
+   * Sizes the element residual blocks (TIME and NONTIME) of a variable. A block is only
+   * zeroed when it was handed out through residualBlock() since it was last prepared.
+   */
+  void prepareResidualBlocks(unsigned int var_num, unsigned int n_dofs);
+
   void addJacobianBlock(SparseMatrix<Number> & jacobian, DenseMatrix<Number> & jac_block, const std::vector<dof_id_type> & idof_indices, const std::vector<dof_id_type> & jdof_indices, Real scaling_factor);
 
 
@@ -705,6 +782,8 @@ protected:
 
   /// residual contributions for each variable from the element
   std::vector<std::vector<DenseVector<Number> > > _sub_Re;
+  /// Flag that indicates if the element residual block was used (same layout as _sub_Re)
+  std::vector<std::vector<unsigned char> > _sub_Re_used;
   /// residual contributions for each variable from the neighbor
   std::vector<std::vector<DenseVector<Number> > > _sub_Rn;
   /// auxiliary vector for scaling residuals (optimization to avoid expensive construction/destruction)
@@ -724,6 +803,20 @@ protected:
   /// auxiliary matrix for scaling jacobians (optimization to avoid expensive construction/destruction)
   DenseMatrix<Number> _tmp_Ke;
 
+  ///@{
+  /// The residual blocks of all the variables and their DOF indices, added to the residual at once by addResidual()
+  std::vector<Number> _coalesced_residual_values;
+  std::vector<dof_id_type> _coalesced_dof_indices;
+  ///@}
+
+  ///@{
+  /// The constrained row and column DOF indices and the blocks of a row of blocks, added to the Jacobian at once by addJacobian()
+  std::vector<dof_id_type> _coalesced_row_indices;
+  std::vector<dof_id_type> _coalesced_col_indices;
+  std::vector<dof_id_type> _coalesced_block_indices;
+  std::vector<DenseMatrix<Number> *> _coalesced_blocks;
+  ///@}
+
   // Shape function values, gradients. second derivatives
   VariablePhiValue _phi;
   VariablePhiGradient _grad_phi;
@@ -774,12 +867,105 @@ protected:
   /// Cached shape function values stored by element
   std::map<dof_id_type, ElementFEShapeData * > _element_fe_shape_data_cache;
 
+  /**
+   * The face data of a side of an element, with the normals and the reference points of the face
+   * quadrature points on the neighbor, so that internal sides do not repeat the inverse map.
+   */
+  class SideFEShapeData : public ElementFEShapeData
+  {
+  public:
+    /// The face quadrature rule the data was computed with
+    const QBase * _qrule;
+
+    /// Cached normals
+    MooseArray<Point> _normals;
+
+    /// The id of the neighbor the reference points were computed on, DofObject::invalid_id if none
+    dof_id_type _neighbor_id;
+
+    /// Cached reference points of the face quadrature points on the neighbor
+    std::vector<Point> _neighbor_reference_points;
+  };
+
+  /// Cached face shape function values stored by element and side
+  std::map<std::pair<dof_id_type, unsigned int>, SideFEShapeData *> _side_fe_shape_data_cache;
+
+  /// The cached data of the current side, NULL if the face data is not cached
+  SideFEShapeData * _current_side_fe_shape_data;
+
   /// Whether or not fe cache should be built at all
   bool _should_use_fe_cache;
 
   /// Whether or not fe should currently be cached - This will be false if something funky is going on with the quadrature rules.
   bool _currently_fe_caching;
 
+  /**
+   * Shape functions, JxW and quadrature points computed on an element, with the geometry of
+   * the element: elements whose nodes have the same offsets from their first node are translated
+   * copies and share everything but the quadrature point positions.
+   */
+  class CongruentElementFEShapeData
+  {
+  public:
+    /// The position of the first node of the element the data was computed on
+    Point _origin;
+
+    /// The positions of the other nodes relative to the first one
+    std::vector<Point> _node_offsets;
+
+    /// The cached data
+    ElementFEShapeData _data;
+  };
+
+  /// Cached shape function values stored by element type, p-level and volume quadrature rule
+  std::map<std::tuple<ElemType, unsigned int, const QBase *>, std::vector<CongruentElementFEShapeData *> > _congruent_fe_shape_data_cache;
+
+  /// Whether or not the geometry cache should be used
+  bool _should_use_fe_geometry_cache;
+
+  /// Whether or not the FE types are compatible with the geometry cache
+  bool _fe_geometry_cache_compatible;
+
+  /// Node offsets of the current element (temporary storage for reinitFECongruent())
+  std::vector<Point> _congruent_node_offsets;
+
+  /// Translated quadrature points when the geometry cache is used
+  MooseArray<Point> _congruent_q_points;
+
+  /**
+   * Shape functions, their gradients and JxW computed on the reference element, along with the
+   * values and gradients of the geometric basis that give the deformation gradient.
+   */
+  class ReferenceElementFEShapeData
+  {
+  public:
+    /// The quadrature rule the data was computed with
+    const QBase * _qrule;
+
+    /// The cached data
+    ElementFEShapeData _data;
+
+    /// Values of the geometric basis functions, indexed by node and quadrature point
+    std::vector<std::vector<Real> > _map_phi;
+
+    /// Reference gradients of the geometric basis functions, indexed by node and quadrature point
+    std::vector<std::vector<RealGradient> > _map_dphi;
+  };
+
+  /// Reference data stored by element id
+  std::map<dof_id_type, ReferenceElementFEShapeData *> _reference_fe_shape_data_cache;
+
+  /// The undisplaced mesh of the reference geometry cache, NULL if it is not used
+  const MooseMesh * _reference_mesh;
+
+  ///@{
+  /// Mapped gradients, quadrature points and JxW when the reference geometry cache is used
+  std::map<FEType, std::vector<std::vector<RealGradient> > > _reference_grad_phi;
+  std::vector<Point> _reference_q_points;
+  std::vector<Real> _reference_JxW;
+  std::vector<RealTensor> _reference_inverse_transpose;
+  ///@}
+
   // Shape function values, gradients. second derivatives for each FE type
   std::map<FEType, FEShapeData * > _fe_shape_data;
   std::map<FEType, FEShapeData * > _fe_shape_data_face;
@@ -794,6 +980,9 @@ protected:
 
   unsigned int _max_cached_residuals;
 
+  /// Scratch (row, value) pairs used to coalesce the cached residual per DOF in addCachedResidual()
+  std::vector<std::pair<dof_id_type, Real> > _coalesced_residual;
+
   /// Values cached by calling cacheJacobian()
   std::vector<Real> _cached_jacobian_values;
   /// Row where the corresponding cached value should go
@@ -22,6 +22,7 @@
 // libMesh include
 #include "libmesh/explicit_system.h"
 #include "libmesh/transient_system.h"
+#include "libmesh/threads.h"
 
 // Forward declarations
 class AuxKernel;
@@ -109,6 +110,29 @@ public:
    */
   std::set<std::string> getDependObjects(ExecFlagType type);
   std::set<std::string> getDependObjects();
+
+  /**
+   * If called with true, the AuxKernels that execute only on linear, nonlinear and timestep_end
+   * and whose variables are not read by any other object are skipped by compute(), from the
+   * time step after the first one computed by this run.  Their variables are computed when an
+   * output writes them (see computeLazyKernels()).  The objects that read a variable are
+   * recorded by variableRead(), so the first time step sees every reader that executes each
+   * step.  Such AuxKernels must not depend on the old values of their own variables.
+   */
+  void setLazyExecution(bool lazy) { _lazy_execution = lazy; }
+
+  /**
+   * Record that an object other than the AuxKernels of the variable reads it; called by
+   * FEProblem::getVariable().  Errors if the variable was skipped since it was last computed.
+   */
+  void variableRead(const std::string & var_name);
+
+  /**
+   * Compute the AuxKernels that were skipped since their last execution, so that the values
+   * of their variables are current.  This is collective; the outputs call it before writing
+   * the field variables.
+   */
+  void computeLazyKernels();
   /**
    * Adds a solution length vector to the system.
    *
@@ -144,8 +168,17 @@ public:
 
 protected:
   void computeScalarVars(ExecFlagType type);
-  void computeNodalVars(ExecFlagType type);
-  void computeElementalVars(ExecFlagType type);
+  void computeNodalVars(const MooseObjectWarehouse<AuxKernel> & nodal);
+  void computeElementalVars(const MooseObjectWarehouse<AuxKernel> & elemental);
+
+  /**
+   * Copy into selected the active AuxKernels of storage that are computed: the stale ones if
+   * stale is true, the ones that are not skipped otherwise (the skipped ones become stale)
+   */
+  void selectKernels(const MooseObjectWarehouse<AuxKernel> & storage, MooseObjectWarehouse<AuxKernel> & selected, bool stale);
+
+  /// Whether the AuxKernel may be skipped because nothing but the outputs reads its variable
+  bool isLazy(AuxKernel & aux) const;
 
   FEProblem & _fe_problem;
 
@@ -176,6 +209,25 @@ protected:
   // Storage for AuxKernel objects
   ExecuteMooseObjectWarehouse<AuxKernel> _elemental_aux_storage;
 
+  /// Whether the AuxKernels that only the outputs depend on are skipped (see setLazyExecution())
+  bool _lazy_execution;
+
+  /// Whether the first time step has been computed, after which the AuxKernels may be skipped
+  bool _lazy_ready;
+
+  /// The variable of the AuxKernel being constructed, whose lookups are not reads
+  std::string _constructed_variable;
+
+  /// The variables read by objects other than their AuxKernels
+  std::set<std::string> _read_variables;
+
+  /// The names of the AuxKernels skipped since their last execution, and their variables
+  std::set<std::string> _stale_kernels;
+  std::set<std::string> _stale_variables;
+
+  /// Protects _read_variables, since the variables are also looked up in the threaded loops
+  Threads::spin_mutex _read_variables_mutex;
+
   friend class AuxKernel;
   friend class ComputeNodalAuxVarsThread;
   friend class ComputeNodalAuxBcsThread;
@@ -0,0 +1,125 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef BLOCKRESIDUALCACHE_H
+#define BLOCKRESIDUALCACHE_H
+
+// MOOSE includes
+#include "MooseTypes.h"
+
+// C++ includes
+#include <map>
+#include <set>
+#include <vector>
+
+// Forward declarations
+class FEProblem;
+class Assembly;
+
+/**
+ * BlockResidualCache keeps the residual contributions of the elements of each block (of this
+ * processor) so that they can be reused by the next residual evaluations while the nonlinear
+ * and auxiliary variables on the block, the time and the time step do not change, e.g. for the
+ * blocks whose variables are frozen during a sub-solve or in a Picard iteration.
+ *
+ * This assumes that the residuals of the elements only depend on these inputs (and not on
+ * postprocessors or values on other blocks), so it is off by default.  Nothing is cached with
+ * displaced problems, DGKernels, InterfaceKernels or user objects computed in the residual loop.
+ */
+class BlockResidualCache
+{
+public:
+  BlockResidualCache();
+
+  /// Start caching
+  void enable() { _enabled = true; }
+
+  /// True if the residuals are cached
+  bool enabled() const { return _enabled; }
+
+  /// Forget the cached residuals, e.g. because the mesh changed
+  void clear();
+
+  /**
+   * Find the blocks whose inputs did not change since their residuals were cached, called before
+   * the residual loop.  The residuals of the other blocks are cached by the loop.
+   */
+  void prepare(FEProblem & fe_problem, Moose::KernelType type);
+
+  /// True if the cached residuals of the elements of the block are reused by the current loop
+  bool reused(SubdomainID subdomain) const { return _reused.count(subdomain) > 0; }
+
+  /// True if the residuals of the elements of the block are cached by the current loop
+  bool recording(SubdomainID subdomain) const { return _recording.count(subdomain) > 0; }
+
+  /**
+   * Cache the residual contributions cached by the assembly for the current element
+   * @param begin The numbers of contributions cached by the assembly before the element, by kernel type
+   */
+  void record(THREAD_ID tid, SubdomainID subdomain, const Assembly & assembly, const std::size_t begin[2]);
+
+  /**
+   * Hand the cached residuals of the reused blocks to the assembly, called after the residual
+   * loop and before the assembly caches are added to the residual.
+   */
+  void finish(FEProblem & fe_problem);
+
+protected:
+  /// The residual contributions cached by one thread, by kernel type (KT_TIME and KT_NONTIME)
+  struct Contributions
+  {
+    std::vector<dof_id_type> rows[2];
+    std::vector<Real> values[2];
+  };
+
+  /// The inputs and the cached residuals of a block
+  struct Block
+  {
+    ///@{ The DOFs of the nonlinear and auxiliary variables on the elements of the block and their values
+    std::vector<dof_id_type> nl_dofs;
+    std::vector<dof_id_type> aux_dofs;
+    std::vector<Number> nl_values;
+    std::vector<Number> aux_values;
+    ///@}
+
+    ///@{ The time, time step size, time step and kernel type of the cached residuals
+    Real time;
+    Real dt;
+    int t_step;
+    Moose::KernelType type;
+    ///@}
+
+    /// True if all the contributions have been cached
+    bool valid;
+
+    /// The cached contributions, by thread
+    std::vector<Contributions> contributions;
+  };
+
+  /// The DOFs of the blocks, from the local elements
+  void buildBlocks(FEProblem & fe_problem);
+
+  /// Whether the residuals are cached
+  bool _enabled;
+
+  /// The blocks of the local elements
+  std::map<SubdomainID, Block> _blocks;
+
+  ///@{ The blocks reused and cached by the current residual loop
+  std::set<SubdomainID> _reused;
+  std::set<SubdomainID> _recording;
+  ///@}
+};
+
+#endif // BLOCKRESIDUALCACHE_H
@@ -49,6 +49,12 @@ protected:
   const MooseObjectWarehouse<AuxKernel> & _aux_kernels;
 
   bool _need_materials;
+
+  ///@{
+  /// The values computed on the elements of this thread and their dofs, inserted into the solution in post()
+  std::vector<Number> _cached_values;
+  std::vector<dof_id_type> _cached_dofs;
+  ///@}
 };
 
 #endif //COMPUTEELEMAUXVARSTHREAD_H
@@ -0,0 +1,74 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef COMPUTEELEMMATERIALAVERAGESTHREAD_H
+#define COMPUTEELEMMATERIALAVERAGESTHREAD_H
+
+// libMesh includes
+#include "libmesh/elem_range.h"
+
+// MOOSE includes
+#include "ThreadedElementLoop.h"
+#include "MaterialData.h"
+
+// Forward declarations
+class FEProblem;
+
+/**
+ * Computes the element averages of Real, RealVectorValue and RealTensorValue material properties
+ * for the output, without auxiliary variables.
+ *
+ * The averages of all the components of the properties are stored by component and then by
+ * element id (component c of element e is values[c * n_elem + e.id()]) like the elemental data of
+ * the Exodus files.  The elements where a property is not defined keep the value they had.
+ */
+class ComputeElemMaterialAveragesThread : public ThreadedElementLoop<ConstElemRange>
+{
+public:
+  ComputeElemMaterialAveragesThread(FEProblem & problem, const std::vector<std::string> & property_names, std::vector<Real> & values);
+  // Splitting Constructor
+  ComputeElemMaterialAveragesThread(ComputeElemMaterialAveragesThread & x, Threads::split split);
+
+  virtual ~ComputeElemMaterialAveragesThread();
+
+  virtual void subdomainChanged() override;
+  virtual void onElement(const Elem * elem) override;
+  virtual void post() override;
+
+  void join(const ComputeElemMaterialAveragesThread & /*y*/);
+
+  /**
+   * The number of components of a material property: 1 for a Real, LIBMESH_DIM for a
+   * RealVectorValue and LIBMESH_DIM^2 for a RealTensorValue, 0 for the other types.
+   */
+  static unsigned int nComponents(const MaterialData & material_data, const std::string & property_name);
+
+protected:
+  /// The names of the properties
+  const std::vector<std::string> & _property_names;
+
+  /// The averages of the components of the properties
+  std::vector<Real> & _values;
+
+  /// The number of elements of the mesh
+  const dof_id_type _n_elem;
+
+  /// The number of components and the index of the first component of each property
+  std::vector<std::pair<unsigned int, unsigned int> > _components;
+
+  /// The properties defined on the current subdomain
+  std::vector<unsigned int> _active_properties;
+};
+
+#endif //COMPUTEELEMMATERIALAVERAGESTHREAD_H
@@ -54,6 +54,9 @@ protected:
 
   unsigned int _num_cached;
 
+  /// Whether the contributions are kept in the thread's cache until the end of the loop instead of added under a lock
+  bool _buffered_assembly;
+
   // Reference to BC storage structures
   const MooseObjectWarehouse<IntegratedBC> & _integrated_bcs;
 
@@ -34,6 +34,7 @@ public:
   ComputeNodalAuxVarsThread(ComputeNodalAuxVarsThread & x, Threads::split split);
 
   void onNode(ConstNodeRange::const_iterator & nd);
+  virtual void post() override;
 
   void join(const ComputeNodalAuxVarsThread & /*y*/);
 
@@ -42,6 +43,12 @@ protected:
 
   /// Storage object containing active AuxKernel objects
   const MooseObjectWarehouse<AuxKernel> & _storage;
+
+  ///@{
+  /// The values computed on the nodes of this thread and their dofs, inserted into the solution in post()
+  std::vector<Number> _cached_values;
+  std::vector<dof_id_type> _cached_dofs;
+  ///@}
 };
 
 #endif //COMPUTENODALAUXVARSTHREAD_H
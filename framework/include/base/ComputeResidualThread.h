@@ -16,6 +16,7 @@
 #define COMPUTERESIDUALTHREAD_H
 
 #include "ThreadedElementLoop.h"
+#include "ElementCostLog.h"
 
 // libMesh includes
 #include "libmesh/elem_range.h"
@@ -29,6 +30,8 @@ class InterfaceKernel;
 class TimeKernel;
 class KernelBase;
 class KernelWarehouse;
+class ElementUserObject;
+class BlockResidualCache;
 
 class ComputeResidualThread : public ThreadedElementLoop<ConstElemRange>
 {
@@ -54,6 +57,15 @@ protected:
   Moose::KernelType _kernel_type;
   unsigned int _num_cached;
 
+  /// Whether the contributions are kept in the thread's cache until the end of the loop instead of added under a lock
+  bool _buffered_assembly;
+
+  /// Whether the time spent on each element is recorded in the ElementCostLog of the problem
+  bool _log_element_costs;
+
+  /// The start of the current element, when the element costs are recorded
+  ElementCostLog::Clock::time_point _elem_start;
+
   /// Reference to BC storage structures
   const MooseObjectWarehouse<IntegratedBC> & _integrated_bcs;
 
@@ -69,6 +81,18 @@ protected:
   const MooseObjectWarehouse<KernelBase> & _time_kernels;
   const MooseObjectWarehouse<KernelBase> & _non_time_kernels;
   ///@}
+
+  /// The ElementUserObjects executed along with the kernels, NULL if there are none (see FEProblem::fusedUserObjects)
+  const MooseObjectWarehouse<ElementUserObject> * _fused_user_objects;
+
+  /// The residual contributions of the blocks whose inputs did not change (see FEProblem::blockResidualCache)
+  BlockResidualCache & _block_residual_cache;
+
+  ///@{
+  /// Whether the contributions of the elements of the current block are reused or cached
+  bool _reuse_block;
+  bool _record_block;
+  ///@}
 };
 
 #endif //COMPUTERESIDUALTHREAD_H
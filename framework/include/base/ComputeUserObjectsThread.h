@@ -37,7 +37,8 @@ public:
                            SystemBase & sys,
                            const MooseObjectWarehouse<ElementUserObject> & elemental_user_objects,
                            const MooseObjectWarehouse<SideUserObject> & side_user_objects,
-                           const MooseObjectWarehouse<InternalSideUserObject> & internal_side_user_objects);
+                           const MooseObjectWarehouse<InternalSideUserObject> & internal_side_user_objects,
+                           bool skip_fused = false);
   // Splitting Constructor
   ComputeUserObjectsThread(ComputeUserObjectsThread & x, Threads::split);
 
@@ -60,6 +61,9 @@ protected:
   const MooseObjectWarehouse<SideUserObject> & _side_user_objects;
   const MooseObjectWarehouse<InternalSideUserObject> & _internal_side_user_objects;
   ///@}
+
+  /// Do not execute the ElementUserObjects that were already executed by the residual evaluation
+  const bool _skip_fused;
 };
 
 #endif //COMPUTEUSEROBJECTSTHREAD_H
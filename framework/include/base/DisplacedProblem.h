@@ -233,6 +233,15 @@ protected:
 
   GeometricSearchData _geometric_search_data;
 
+  /**
+   * Move the displaced nodes to the current displacements.  The Assembly caches, the
+   * geometric searches and the Dirac kernel point locator are only updated if some node moved.
+   */
+  void moveNodes();
+
+  /// True until the geometric searches and the point locator were updated once by updateMesh()
+  bool _first_mesh_update;
+
 private:
   friend class UpdateDisplacedMeshThread;
   friend class Restartable;
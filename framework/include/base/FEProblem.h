@@ -30,6 +30,9 @@
 #include "ExecuteMooseObjectWarehouse.h"
 #include "AuxGroupExecuteMooseObjectWarehouse.h"
 #include "MaterialWarehouse.h"
+#include "ElementCostLog.h"
+#include "BlockResidualCache.h"
+#include "DeferredReduction.h"
 
 // libMesh includes
 #include "libmesh/enum_quadrature_type.h"
@@ -38,6 +41,7 @@
 class DisplacedProblem;
 class FEProblem;
 class MooseMesh;
+struct MeshTemplate;
 class NonlinearSystem;
 class RandomInterface;
 class RandomData;
@@ -319,6 +323,24 @@ public:
    */
   virtual void useFECache(bool fe_cache) override;
 
+  /**
+   * Whether or not this problem should reuse the shape functions of elements that are
+   * translated copies of each other, see Assembly::useFEGeometryCache().
+   *
+   * @param fe_geometry_cache True for using the cache false for not.
+   */
+  void useFEGeometryCache(bool fe_geometry_cache);
+
+  /**
+   * Whether or not the Assembly of the displaced problem should compute the shape functions on the
+   * undisplaced elements once and map them to the displaced elements, see
+   * Assembly::useReferenceGeometryCache().
+   *
+   * @param reference_geometry_cache True for using the cache false for not.
+   */
+  void useReferenceGeometryCache(bool reference_geometry_cache) { _reference_geometry_cache = reference_geometry_cache; }
+  bool referenceGeometryCache() const { return _reference_geometry_cache; }
+
   virtual void init() override;
   virtual void solve() override;
 
@@ -356,6 +378,12 @@ public:
    */
   virtual bool currentlyComputingJacobian() { return _currently_computing_jacobian; }
 
+  /**
+   * The element user objects to execute in the element loop of the current residual evaluation,
+   * NULL if there are none (see ElementUserObject::fuseWithResidual())
+   */
+  const MooseObjectWarehouse<ElementUserObject> * fusedUserObjects() const { return _fusing_user_objects ? &_fused_user_objects : NULL; }
+
   /**
    * Returns true if we are in or beyond the initialSetup stage
    */
@@ -479,6 +507,12 @@ public:
 
   void projectSolution();
 
+  /**
+   * Set the solution to the initial condition projected by the first sub-app created from the same
+   * input file (MultiApp/share_initial_condition) instead of projecting it again.
+   */
+  void copyInitialSolution(const MeshTemplate & mesh_template);
+
   // Materials /////
   void addMaterial(const std::string & kernel_name, const std::string & name, InputParameters parameters);
 
@@ -486,9 +520,31 @@ public:
    * Add the MooseVariables that the current materials depend on to the dependency list.
    *
    * This MUST be done after the dependency list has been set for all the other objects!
+   * If active material properties have been set, they are extended with the properties
+   * the materials that supply them depend on.
    */
   virtual void prepareMaterials(SubdomainID blk_id, THREAD_ID tid);
 
+  /**
+   * Set the material properties used by the objects of the current loop.  Until
+   * clearActiveMaterialProperties() is called, reinitMaterials() and friends only compute
+   * the materials supplying these properties (or the properties they depend on) and the
+   * materials with stateful properties.  Does nothing if the "lazy_materials" parameter is false.
+   * @param mat_prop_names The names of the needed material properties
+   * @param tid The thread id
+   */
+  void setActiveMaterialProperties(const std::set<std::string> & mat_prop_names, THREAD_ID tid);
+
+  /**
+   * Whether or not the materials computed by reinitMaterials() are restricted by setActiveMaterialProperties()
+   */
+  bool hasActiveMaterialProperties(THREAD_ID tid) const { return _has_active_material_properties[tid]; }
+
+  /**
+   * Compute all materials again in reinitMaterials() and friends
+   */
+  void clearActiveMaterialProperties(THREAD_ID tid);
+
   virtual void reinitMaterials(SubdomainID blk_id, THREAD_ID tid, bool swap_stateful = true);
   virtual void reinitMaterialsFace(SubdomainID blk_id, THREAD_ID tid, bool swap_stateful = true);
   virtual void reinitMaterialsNeighbor(SubdomainID blk_id, THREAD_ID tid, bool swap_stateful = true);
@@ -580,6 +636,7 @@ public:
    * Returns whether or not the current simulation has any multiapps
    */
   bool hasMultiApps() const { return _multi_apps.hasActiveObjects(); }
+  const ExecuteMooseObjectWarehouse<MultiApp> & getMultiAppWarehouse() { return _multi_apps; }
   bool hasMultiApp(const std::string & name);
 
   /**
@@ -851,6 +908,20 @@ public:
    * @return The number of adaptivity cycles completed.
    */
   unsigned int getNumCyclesCompleted() { return _cycles_completed; }
+
+  ///@{
+  /**
+   * The number of uniform refinements left for grid sequencing (Executioner/num_grids): until
+   * they are done the mesh is that many levels coarser than requested with Mesh/uniform_refine.
+   */
+  unsigned int numGridSteps() const { return _num_grid_steps; }
+  void numGridSteps(unsigned int num_grid_steps) { _num_grid_steps = num_grid_steps; }
+  ///@}
+
+  /**
+   * Uniformly refine the mesh once for grid sequencing, the solution is projected on the finer mesh.
+   */
+  virtual void uniformRefine();
 #endif //LIBMESH_ENABLE_AMR
 
   /// Create XFEM controller object
@@ -867,6 +938,25 @@ public:
 
   virtual void meshChanged() override;
 
+  /**
+   * Repartition the mesh if it uses a CostWeightedPartitioner and the element costs measured
+   * since the last check are imbalanced.  The stateful material properties are moved to the
+   * new owners of their elements.
+   * @return true if the mesh was repartitioned
+   */
+  virtual bool rebalanceMesh();
+
+  /// The residual computation time of the elements, recorded if a partitioner uses it
+  ElementCostLog & elementCostLog() { return _element_cost_log; }
+
+  /// The residual contributions of the blocks whose inputs did not change, if "cache_block_residuals" is set
+  BlockResidualCache & blockResidualCache() { return _block_residual_cache; }
+
+  /**
+   * The reductions of the Postprocessors that are packed together when they are finalized
+   */
+  DeferredReduction & deferredReduction() { return _deferred_reduction; }
+
   /**
    * Register an object that derives from MeshChangedInterface
    * to be notified when the mesh changes.
@@ -1113,6 +1203,22 @@ protected:
   MaterialWarehouse _all_materials; // All materials for error checking and MaterialData storage
   ///@}
 
+  ///@{
+  /// Material properties needed by the current loop, see setActiveMaterialProperties() (THREAD_ID on outer vector)
+  const bool _lazy_materials;
+  std::vector<std::set<std::string> > _active_material_properties;
+  std::vector<unsigned int> _has_active_material_properties;
+  ///@}
+
+  /// The subset of a vector of materials that must be computed for the active material properties (THREAD_ID on outer vector)
+  std::vector<std::map<const std::vector<MooseSharedPointer<Material> > *, std::vector<MooseSharedPointer<Material> > > > _active_materials;
+
+  /**
+   * The materials in the supplied vector that must be computed for the active material properties,
+   * or the vector itself if no active material properties are set.
+   */
+  const std::vector<MooseSharedPointer<Material> > & activeMaterials(const std::vector<MooseSharedPointer<Material> > & materials, THREAD_ID tid);
+
   ///@{
   // Indicator Warehouses
   MooseObjectWarehouse<Indicator> _indicators;
@@ -1138,6 +1244,19 @@ protected:
   AuxGroupExecuteMooseObjectWarehouse<InternalSideUserObject> _internal_side_user_objects;
   ///@}
 
+  /// The ElementUserObjects executed in the element loop of the residual evaluations
+  MooseObjectWarehouse<ElementUserObject> _fused_user_objects;
+
+  /// True while a residual evaluation executes _fused_user_objects
+  bool _fusing_user_objects;
+
+  /// The solutions the last residual evaluation that executed _fused_user_objects was done with
+  std::unique_ptr<NumericVector<Number> > _fused_solution;
+  std::unique_ptr<NumericVector<Number> > _fused_aux_solution;
+
+  /// True if the last residual evaluation that executed _fused_user_objects was done with the current solutions
+  bool fusedUserObjectsCurrent();
+
   /// MultiApp Warehouse
   ExecuteMooseObjectWarehouse<MultiApp> _multi_apps;
 
@@ -1185,9 +1304,36 @@ protected:
    */
   void reinitBecauseOfGhostingOrNewGeomObjects();
 
+  /**
+   * Move the stateful properties of the elements that changed processor in a repartitioning
+   * to their new owners
+   * @param storage The volume or boundary property storage
+   * @param material_data The MaterialData that describes the properties of storage
+   * @param tag_number The MPI tag to communicate with
+   */
+  void redistributeStatefulProps(MaterialPropertyStorage & storage, MaterialData & material_data, int tag_number);
+
+  /// The residual computation time of the elements
+  ElementCostLog _element_cost_log;
+
+  /// The residual contributions of the blocks whose inputs did not change
+  BlockResidualCache _block_residual_cache;
+
+  /// Packs the reductions of the Postprocessors finalized together
+  DeferredReduction _deferred_reduction;
+
+  /// The Postprocessors finalized with their reductions deferred, see finalizeUserObjects()
+  std::vector<Postprocessor *> _deferred_postprocessors;
+
+  /// Reduce the values of the Postprocessors in _deferred_postprocessors and store them
+  void storeDeferredPostprocessorValues();
+
 #ifdef LIBMESH_ENABLE_AMR
   Adaptivity _adaptivity;
   unsigned int _cycles_completed;
+
+  /// The number of uniform refinements left for grid sequencing
+  unsigned int _num_grid_steps;
 #endif
 
   /// Pointer to XFEM controller
@@ -1236,6 +1382,9 @@ protected:
   /// Determines whether a check to verify an active material on every subdomain
   bool _material_coverage_check;
 
+  /// Whether the displaced Assembly maps the shape functions of the undisplaced elements
+  bool _reference_geometry_cache;
+
   /// Maximum number of quadrature points used in the problem
   unsigned int _max_qps;
 
@@ -1334,14 +1483,22 @@ FEProblem::finalizeUserObjects(const MooseObjectWarehouse<T> & warehouse)
         objects[i]->threadJoin(*(other_objects[i]));
     }
 
-    // Finalize them and save off PP values
+    // Finalize them and save off PP values, the values of the PPs that allow it are
+    // stored by storeDeferredPostprocessorValues() after a packed reduction
     for (auto & object : objects)
     {
       object->finalize();
 
       auto pp = MooseSharedNamespace::dynamic_pointer_cast<Postprocessor>(object);
 
-      if (pp)
+      if (pp && pp->deferReduction())
+      {
+        _deferred_reduction.startRecording();
+        pp->getValue();
+        _deferred_reduction.stopRecording();
+        _deferred_postprocessors.push_back(pp.get());
+      }
+      else if (pp)
         _pps_data.storeValue(pp->PPName(), pp->getValue());
     }
   }
@@ -74,6 +74,17 @@ extern PerfLog perf_log;
  * PerfLog to be used during setup.  This log will get printed just before the first solve. */
 extern PerfLog setup_perf_log;
 
+/**
+ * Push an event onto Moose::perf_log and, if it is enabled, record it in the
+ * timeline kept by Moose::trace_log (see TraceLog and the ChromeTrace output).
+ */
+void perfPush(const std::string & label, const std::string & header);
+
+/**
+ * Pop an event pushed by perfPush().
+ */
+void perfPop(const std::string & label, const std::string & header);
+
 /**
  * Variable indicating whether we will enable FPE trapping for this run.
  */
@@ -29,6 +29,7 @@
 #include "libmesh/parallel_object.h"
 
 // C++ includes
+#include <chrono>
 #include <list>
 #include <map>
 #include <set>
@@ -42,6 +43,7 @@ class MeshModifier;
 class InputParameterWarehouse;
 class SystemInfo;
 class CommandLine;
+struct MeshTemplate;
 
 template<>
 InputParameters validParams<MooseApp>();
@@ -155,6 +157,23 @@ public:
    */
   Point getOutputPosition() { return _output_position; }
 
+  /**
+   * Share the built mesh with the other sub-apps of a MultiApp created from the same input
+   * (MultiApp/share_mesh): the mesh of this app is copied from the template if it is already
+   * built, otherwise it is stored in it.
+   */
+  void setMeshTemplate(MooseSharedPointer<MeshTemplate> mesh_template) { _mesh_template = mesh_template; }
+
+  /**
+   * The mesh shared with the other sub-apps created from the same input, NULL if it is not shared.
+   */
+  MeshTemplate * meshTemplate() const { return _mesh_template.get(); }
+
+  /**
+   * The communicator of this App, for the objects that outlive it.
+   */
+  const MooseSharedPointer<Parallel::Communicator> & getCommunicator() const { return _comm; }
+
   /**
    * Set the starting time for the simulation.  This will override any choice
    * made in the input file.
@@ -264,6 +283,13 @@ public:
    */
   virtual void executeExecutioner();
 
+  /**
+   * Record the end of a phase of the application startup, for the report printed with
+   * --startup-timing.  The phase began at the end of the previous one, or at the
+   * construction of the application for the first phase.
+   */
+  void recordStartupPhase(const std::string & name);
+
   /**
    * Returns true if the user specified --distributed-mesh (or
    * --parallel-mesh, for backwards compatibility) on the command line
@@ -403,8 +429,9 @@ public:
   /**
    * Create a Backup from the current App.  A Backup contains all the data necessary to be able
    * to restore the state of an App.
+   * @param in_memory Copy the system vectors instead of serializing them, see Backup
    */
-  MooseSharedPointer<Backup> backup();
+  MooseSharedPointer<Backup> backup(bool in_memory = false);
 
   /**
    * Restore a Backup.  This sets the App's state.
@@ -528,6 +555,9 @@ public:
   /// The output position
   Point _output_position;
 
+  /// The mesh shared with the other sub-apps created from the same input
+  MooseSharedPointer<MeshTemplate> _mesh_template;
+
   /// Whether or not an start time has been set
   bool _start_time_set;
 
@@ -656,6 +686,12 @@ private:
   /// Cache for a Backup to use for restart / recovery
   MooseSharedPointer<Backup> _cached_backup;
 
+  /// The end of the last startup phase recorded by recordStartupPhase()
+  std::chrono::steady_clock::time_point _startup_phase_start;
+
+  /// The name and wall time (seconds) of each startup phase
+  std::vector<std::pair<std::string, Real> > _startup_phases;
+
   // Allow FEProblem to set the recover/restart state, so make it a friend
   friend class FEProblem;
   friend class Restartable;
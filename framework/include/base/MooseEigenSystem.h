@@ -92,6 +92,20 @@ public:
    */
   bool activeOnOld();
 
+  /**
+   * Apply a Wielandt shift to the eigen kernels: the kernels on the current solution are
+   * enabled together with the ones on the old solution, so that a power iteration solves
+   * (A - B/k_s) x = (1/k - 1/k_s) B x_old.
+   *
+   * @param inverse_shift The inverse of the shift 1/k_s, zero turns the shift off.
+   */
+  void setWielandtShift(Real inverse_shift);
+
+  /**
+   * The inverse of the current Wielandt shift, zero if there is no shift
+   */
+  Real wielandtShift() const { return _inverse_shift; }
+
   /**
    * Get variable names of the eigen system
    */
@@ -110,6 +124,9 @@ protected:
 
   bool _active_on_old;
 
+  /// Inverse of the Wielandt shift
+  Real _inverse_shift;
+
   /// counter of eigen kernels
   unsigned int _eigen_kernel_counter;
 };
@@ -115,6 +115,16 @@ public:
   void updateBoundaryVariableDependency(BoundaryID id, std::set<MooseVariable *> & needed_moose_vars, THREAD_ID tid = 0) const;
   ///@}
 
+  ///@{
+  /**
+   * Update material property dependency set (the names of the properties used by the active objects).
+   */
+  void updateMatPropDependency(std::set<std::string> & needed_mat_props, THREAD_ID tid = 0) const;
+  void updateBlockMatPropDependency(SubdomainID id, std::set<std::string> & needed_mat_props, THREAD_ID tid = 0) const;
+  void updateBoundaryMatPropDependency(std::set<std::string> & needed_mat_props, THREAD_ID tid = 0) const;
+  void updateBoundaryMatPropDependency(BoundaryID id, std::set<std::string> & needed_mat_props, THREAD_ID tid = 0) const;
+  ///@}
+
   /**
    * Populates a set of covered subdomains and the associated variable names.
    */
@@ -160,6 +170,12 @@ protected:
   static void updateVariableDependencyHelper(std::set<MooseVariable *> & needed_moose_vars,
                                              const std::vector<MooseSharedPointer<T> > & objects);
 
+  /**
+   * Helper method for updating material property dependency set
+   */
+  static void updateMatPropDependencyHelper(std::set<std::string> & needed_mat_props,
+                                            const std::vector<MooseSharedPointer<T> > & objects);
+
   /**
    * Calls assert on thread id.
    */
@@ -540,6 +556,56 @@ MooseObjectWarehouseBase<T>::updateVariableDependencyHelper(std::set<MooseVariab
 }
 
 
+template<typename T>
+void
+MooseObjectWarehouseBase<T>::updateMatPropDependency(std::set<std::string> & needed_mat_props, THREAD_ID tid/* = 0*/) const
+{
+  if (hasActiveObjects(tid))
+    updateMatPropDependencyHelper(needed_mat_props, _active_objects[tid]);
+}
+
+
+template<typename T>
+void
+MooseObjectWarehouseBase<T>::updateBlockMatPropDependency(SubdomainID id, std::set<std::string> & needed_mat_props, THREAD_ID tid/* = 0*/) const
+{
+  if (hasActiveBlockObjects(id, tid))
+    updateMatPropDependencyHelper(needed_mat_props, getActiveBlockObjects(id, tid));
+}
+
+
+template<typename T>
+void
+MooseObjectWarehouseBase<T>::updateBoundaryMatPropDependency(std::set<std::string> & needed_mat_props, THREAD_ID tid/* = 0*/) const
+{
+  if (hasActiveBoundaryObjects(tid))
+    for (const auto & it : _active_boundary_objects[tid])
+      updateMatPropDependencyHelper(needed_mat_props, it.second);
+}
+
+
+template<typename T>
+void
+MooseObjectWarehouseBase<T>::updateBoundaryMatPropDependency(BoundaryID id, std::set<std::string> & needed_mat_props, THREAD_ID tid/* = 0*/) const
+{
+  if (hasActiveBoundaryObjects(id, tid))
+    updateMatPropDependencyHelper(needed_mat_props, getActiveBoundaryObjects(id, tid));
+}
+
+
+template<typename T>
+void
+MooseObjectWarehouseBase<T>::updateMatPropDependencyHelper(std::set<std::string> & needed_mat_props,
+                                                           const std::vector<MooseSharedPointer<T> > & objects)
+{
+  for (const auto & object : objects)
+  {
+    const std::set<std::string> & mp_deps = object->getMatPropDependencies();
+    needed_mat_props.insert(mp_deps.begin(), mp_deps.end());
+  }
+}
+
+
 template<typename T>
 void
 MooseObjectWarehouseBase<T>::subdomainsCovered(std::set<SubdomainID> & subdomains_covered, std::set<std::string> & unique_variables, THREAD_ID tid/*=0*/) const
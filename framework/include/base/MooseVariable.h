@@ -51,6 +51,25 @@ public:
 
   void prepare();
 
+  /**
+   * Set the variable of the same libMesh VariableGroup whose element DOF indices this variable's are
+   * derived from, see prepareFromGroup().
+   * @param leader The first variable of the group
+   * @param offset The index of this variable in the group
+   */
+  void setGroupLeader(MooseVariable * leader, unsigned int offset);
+
+  /// The first variable of the VariableGroup of this variable, NULL if the DOF indices are looked up
+  MooseVariable * groupLeader() { return _group_leader; }
+
+  /**
+   * Same as prepare(), but the DOF indices are derived from the ones of the group leader, which
+   * has to be prepared on the current element first.  The DOFs of the variables of a VariableGroup
+   * are interleaved, so with one DOF per node or element the DOF of this variable is the leader's
+   * DOF plus the offset of this variable in the group.
+   */
+  void prepareFromGroup();
+
   void prepareNeighbor();
   void prepareAux();
   void prepareIC();
@@ -251,6 +270,12 @@ public:
   void insert(NumericVector<Number> & residual);
   void add(NumericVector<Number> & residual);
 
+  /**
+   * Append the values that insert() would set, and their dof indices, to values and dof_indices,
+   * so that the values of many elements or nodes can be inserted at once
+   */
+  void cacheNodalValues(std::vector<Number> & values, std::vector<dof_id_type> & dof_indices) const;
+
   /**
    * Get the value of this variable at given node
    */
@@ -307,6 +332,15 @@ protected:
    */
   void getDofIndices(const Elem * elem, std::vector<dof_id_type> & dof_indices);
 
+  /**
+   * Compute the values at the quadrature points of the current element or side
+   * @param nqp The number of quadrature points
+   * @param phi The shape functions
+   * @param grad_phi The shape function gradients
+   * @param second_phi The shape function second derivatives, used if second derivatives are needed
+   */
+  void computeElemValuesHelper(unsigned int nqp, const VariablePhiValue & phi, const VariablePhiGradient & grad_phi, const VariablePhiSecond * second_phi);
+
 protected:
   /// Thread ID
   THREAD_ID _tid;
@@ -416,6 +450,11 @@ protected:
 
   // nodal stuff
 
+  ///@{ The first variable of the VariableGroup and the offset of this variable in it, see prepareFromGroup()
+  MooseVariable * _group_leader;
+  unsigned int _group_offset;
+  ///@}
+
   /// If the variable is defined at the node (used in compute nodal values)
   bool _is_defined;
   /// If true, the nodal value gets inserted on calling insert()
@@ -82,6 +82,9 @@ public:
   virtual void timestepSetup();
 
   void setupFiniteDifferencedPreconditioner();
+
+  /// Free the finite difference coloring, it is rebuilt by the next setupFiniteDifferencedPreconditioner()
+  void destroyFiniteDifferenceColoring();
   void setupFieldDecomposition();
 
   bool haveFiniteDifferencedPreconditioner() {return _use_finite_differenced_preconditioner;}
@@ -318,6 +321,12 @@ public:
    */
   void useFiniteDifferencedPreconditioner(bool use = true) { _use_finite_differenced_preconditioner = use; }
 
+  /**
+   * If called with true (the default) the finite differenced preconditioner perturbs groups of
+   * structurally independent DOFs together, otherwise it perturbs every DOF separately
+   */
+  void useFiniteDifferenceColoring(bool use = true) { _use_finite_difference_coloring = use; }
+
   /**
    * If called with a single string, it is used as the name of a the top-level decomposition split.
    * If the array is empty, no decomposition is used.
@@ -389,6 +398,79 @@ public:
    */
   unsigned int nResidualEvaluations() { return _n_residual_evaluations; }
 
+  /**
+   * Return the total number of Jacobian evaluations done so far in this calculation
+   */
+  unsigned int nJacobianEvaluations() { return _n_jacobian_evaluations; }
+
+  /**
+   * Return the number of residuals requested by the solver that were not evaluated because
+   * they had just been computed for the same solution (see setResidualReuse())
+   */
+  unsigned int nReusedResiduals() { return _n_reused_residuals; }
+
+  /**
+   * If called with true, a residual requested by the solver for the solution of the previous
+   * residual evaluation within the same solve is copied instead of computed again
+   */
+  void setResidualReuse(bool reuse);
+
+  /**
+   * If called with true, the threaded residual and Jacobian loops keep the contributions of
+   * their elements in the per-thread cache of the Assembly until the end of the loop, when they
+   * are added to the global vector or matrix one thread at a time.  Otherwise the caches are
+   * added every 20 elements under a lock shared by all the threads.
+   */
+  void setBufferedAssembly(bool buffered) { _buffered_assembly = buffered; }
+
+  /// Whether the threaded loops buffer their contributions (see setBufferedAssembly())
+  bool bufferedAssembly() const { return _buffered_assembly; }
+
+  /**
+   * Copy the last residual computed for the solver into residual, if it was computed with
+   * the same solution and time in the current solve
+   * @return true if the residual was reused
+   */
+  bool reuseResidual(const NumericVector<Number> & soln, NumericVector<Number> & residual);
+
+  /// Remember residual as the residual of soln, for reuseResidual()
+  void cacheResidual(const NumericVector<Number> & soln, const NumericVector<Number> & residual);
+
+  /// Forget the cached residual, e.g. because the state of the problem changed
+  void clearResidualCache() { _residual_cache_valid = false; }
+
+  /**
+   * Return the total number of Jacobian evaluations done so far in this calculation
+   * that were followed by a rebuild of the preconditioner
+   */
+  unsigned int nPreconditionerRebuilds() { return _n_preconditioner_rebuilds; }
+
+  /**
+   * Set the policy for lagging (re-using) the Jacobian and the preconditioner.
+   * A Jacobian lag of n rebuilds the Jacobian every n nonlinear iterations (or every n
+   * solves if lag_over_solves is true), a preconditioner lag of n rebuilds the
+   * preconditioner every n Jacobian evaluations, and a lag of -1 builds the matrix once.
+   * The counters persist across time steps.  Both matrices are rebuilt regardless of the
+   * lags after a failed solve and when the previous linear solve needed more than
+   * max_linear_its iterations (0 disables this check).
+   */
+  void setMatrixLagging(int lag_jacobian, int lag_preconditioner, bool lag_over_solves, unsigned int max_linear_its);
+
+  /**
+   * Whether the Jacobian or preconditioner are lagged, i.e., whether
+   * updateMatrixLagging() needs to be called before each nonlinear iteration
+   */
+  bool lagMatrices() const { return _lag_matrices; }
+
+  /**
+   * Decide whether the Jacobian and the preconditioner are rebuilt in a nonlinear iteration
+   * @param it The nonlinear iteration that is about to start, 0 at the start of a solve
+   * @param linear_its The number of iterations of the last linear solve
+   * @param rebuild_jacobian True if the Jacobian must be re-assembled
+   * @param rebuild_preconditioner True if the preconditioner must be rebuilt
+   */
+  void updateMatrixLagging(unsigned int it, unsigned int linear_its, bool & rebuild_jacobian, bool & rebuild_preconditioner);
+
   /**
    * Return the final nonlinear residual
    */
@@ -592,9 +674,15 @@ protected:
 
   /// Whether or not to use a finite differenced preconditioner
   bool _use_finite_differenced_preconditioner;
+  /// Whether or not the finite differenced preconditioner uses a coloring of the sparsity pattern
+  bool _use_finite_difference_coloring;
 #ifdef LIBMESH_HAVE_PETSC
   MatFDColoring _fdcoloring;
+  /// Whether _fdcoloring has been built for the current sparsity pattern
+  bool _fdcoloring_initialized;
 #endif
+  /// The sparsity pattern of the local rows of the Jacobian, kept until the coloring is built from it
+  SparsityPattern::Graph _fd_sparsity;
   /// Whether or not the system can be decomposed into splits
   bool _have_decomposition;
   /// Name of the top-level split of the decomposition
@@ -605,6 +693,13 @@ protected:
   /// Whether or not to add implicit geometric couplings to the Jacobian for FDP
   bool _add_implicit_geometric_coupling_entries_to_jacobian;
 
+  /**
+   * Whether the geometric coupling entries have been inserted in the Jacobian since its
+   * sparsity was last computed.  PETSc frees the preallocated entries that are not set in
+   * the first assembly, so they must be inserted (as zeros) after every reallocation.
+   */
+  bool _geometric_coupling_entries_inserted;
+
   /// Whether or not to assemble the residual and Jacobian after the application of each constraint.
   bool _assemble_constraints_separately;
 
@@ -630,6 +725,63 @@ protected:
   /// Total number of residual evaluations that have been performed
   unsigned int _n_residual_evaluations;
 
+  /// Total number of Jacobian evaluations that have been performed
+  unsigned int _n_jacobian_evaluations;
+
+  /// Number of residual evaluations that were avoided by reusing the cached residual
+  unsigned int _n_reused_residuals;
+
+  /// The solution and residual of the last residual evaluation requested by the solver, NULL if not in use
+  NumericVector<Number> * _residual_cache_solution;
+  NumericVector<Number> * _residual_cache;
+
+  /// Whether the cached residual can be reused
+  bool _residual_cache_valid;
+
+  /// The time and time step of the cached residual
+  Real _residual_cache_time;
+  Real _residual_cache_dt;
+
+  /// Whether the threaded loops add their contributions at the end of the loop (see setBufferedAssembly())
+  bool _buffered_assembly;
+
+  /// Total number of Jacobian evaluations that were followed by a preconditioner rebuild
+  unsigned int _n_preconditioner_rebuilds;
+
+  /// The lagging state of the Jacobian or of the preconditioner
+  struct MatrixLag
+  {
+    MatrixLag() : lag(1), since_rebuild(0), built(false) {}
+
+    /**
+     * Decide whether the matrix is rebuilt and update the counters
+     * @param new_solve True at the first nonlinear iteration of a solve
+     * @param lag_over_solves True if the lag counts solves instead of nonlinear iterations
+     * @param force Rebuild regardless of the lag
+     */
+    bool rebuild(bool new_solve, bool lag_over_solves, bool force);
+
+    /// Rebuild every lag iterations or solves, -1 for never (after the first build)
+    int lag;
+
+    /// Iterations or solves since the last rebuild
+    unsigned int since_rebuild;
+
+    /// Whether the matrix has been built at least once
+    bool built;
+  };
+
+  ///@{
+  /// Jacobian and preconditioner lagging, see setMatrixLagging()
+  bool _lag_matrices;
+  bool _lag_over_solves;
+  unsigned int _lag_max_linear_its;
+  bool _lag_force_rebuild;
+  MatrixLag _jacobian_lag;
+  MatrixLag _preconditioner_lag;
+  bool _reuse_preconditioner;
+  ///@}
+
   Real _final_residual;
 
   /// If predictor is active, this is non-NULL
@@ -40,7 +40,13 @@ public:
 
   virtual void onNode(SemiLocalNodeRange::const_iterator & nd) override;
 
-  void join(const UpdateDisplacedMeshThread & /*y*/);
+  void join(const UpdateDisplacedMeshThread & y);
+
+  /// True if the position of some node changed
+  bool meshMoved() const { return _mesh_moved; }
+
+  /// The boundaries with a node whose position changed
+  const std::set<BoundaryID> & movedBoundaries() const { return _moved_boundaries; }
 
 protected:
   DisplacedProblem & _displaced_problem;
@@ -62,6 +68,12 @@ private:
 
   unsigned int _nonlinear_system_number;
   unsigned int _aux_system_number;
+
+  bool _mesh_moved;
+  std::set<BoundaryID> _moved_boundaries;
+
+  /// Scratch space for the boundary ids of a node
+  std::vector<boundary_id_type> _node_boundary_ids;
 };
 
 #endif /* UPDATEDISPLACEDMESHTHREAD_H */
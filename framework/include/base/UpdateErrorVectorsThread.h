@@ -34,7 +34,13 @@ public:
 
   virtual void onElement(const Elem * elem) override;
 
-  void join(const UpdateErrorVectorsThread & /*y*/);
+  void join(const UpdateErrorVectorsThread & y);
+
+  /// The smallest and largest values put in each ErrorVector by this thread
+  const std::map<const ErrorVector *, std::pair<Real, Real> > & ranges() const { return _ranges; }
+
+  /// The number of elements visited by this thread
+  dof_id_type numElements() const { return _n_elem; }
 
 protected:
   const std::map<std::string, std::unique_ptr<ErrorVector> > & _indicator_field_to_error_vector;
@@ -44,6 +50,12 @@ protected:
   NumericVector<Number> & _solution;
 
   std::map<unsigned int, ErrorVector *> _indicator_field_number_to_error_vector;
+
+  /// The smallest and largest values of each ErrorVector, computed while filling them
+  std::map<const ErrorVector *, std::pair<Real, Real> > _ranges;
+
+  /// The number of elements visited
+  dof_id_type _n_elem;
 };
 
 #endif //UPDATEERRORVECTORSTHREAD_H
@@ -18,6 +18,7 @@
 //MOOSE includes
 #include "Constraint.h"
 #include "NeighborCoupleableMooseVariableDependencyIntermediateInterface.h"
+#include "NodeElemAdjacency.h"
 
 //Forward Declarations
 class NodeFaceConstraint;
@@ -197,7 +198,7 @@ protected:
   /// DOF map
   const DofMap & _dof_map;
 
-  const std::map<dof_id_type, std::vector<dof_id_type> > & _node_to_elem_map;
+  const NodeElemAdjacency & _node_to_elem_map;
 
   /**
    * Whether or not the slave's residual should be overwritten.
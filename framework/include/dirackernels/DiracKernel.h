@@ -141,6 +141,14 @@ protected:
    */
   const Elem * addPoint(Point p, unsigned id=libMesh::invalid_uint);
 
+  /**
+   * Add many points, each with a unique ID, as addPoint(Point, id) does for one.
+   * The caches are checked and the points that are not cached are located in a
+   * single pass, with a fixed number of parallel reductions rather than a few per
+   * point.  Use this when a DiracKernel adds a large number of points.
+   */
+  void addPointsWithIds(const std::vector<Point> & points, const std::vector<unsigned> & ids);
+
   /**
    * Returns the user-assigned ID of the current Dirac point if it
    * exits, and libMesh::invalid_uint otherwise.  Can be used e.g. in
@@ -244,6 +252,11 @@ private:
   /// A helper function for addPoint(Point, id) for when
   /// id != invalid_uint.
   const Elem * addPointWithValidId(Point p, unsigned id);
+
+  /// A helper function for addPointsWithIds() and addPointWithValidId(), returns the Elem of each point
+  void locateAndAddPoints(const std::vector<Point> & points,
+                          const std::vector<unsigned> & ids,
+                          std::vector<const Elem *> & elems);
 };
 
 #endif
@@ -87,6 +87,16 @@ public:
    */
   const Elem * findPoint(Point p, const MooseMesh& mesh);
 
+  /**
+   * Find the Elems containing each of the Points, as findPoint() does for one Point, but
+   * with a single parallel reduction for all of them.  This is a parallel_only() function,
+   * so it must be called with the same points on all processors.
+   * @param points The Points to locate
+   * @param mesh The mesh containing the Points
+   * @param elems The Elem containing each Point, or NULL if it is not local or not found
+   */
+  void findPoints(const std::vector<Point> & points, const MooseMesh & mesh, std::vector<const Elem *> & elems);
+
 protected:
   /**
    * Check if two points are equal with respect to a tolerance
@@ -132,6 +132,9 @@ protected:
   const Real & _source_integral;
   Real _source_integral_old;
 
+  /// Shift of the eigenvalue used by the power iterations, zero for unshifted iterations
+  const Real & _wielandt_shift;
+
   /// Postprocessor for normalization
   const Real & _normalization;
   ExecFlagType _norm_execflag;
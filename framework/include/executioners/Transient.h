@@ -16,10 +16,13 @@
 #define TRANSIENT_H
 
 #include "Executioner.h"
+#include "PicardAcceleration.h"
 
 // System includes
 #include <string>
 #include <fstream>
+#include <map>
+#include <memory>
 
 // Forward Declarations
 class Transient;
@@ -212,6 +215,20 @@ protected:
    */
   virtual void solveStep(Real input_dt = -1.0);
 
+  /**
+   * Execute the MultiApps (and their Transfers) for the supplied flag and, when
+   * doing Picard iterations, apply the Picard acceleration to the relaxed
+   * variables and postprocessors they changed.
+   * @return false if the MultiApps failed to solve
+   */
+  bool execMultiApps(ExecFlagType type);
+
+  /// Fill values with the local values of the relaxed variables and postprocessors
+  void getPicardValues(std::vector<Real> & values);
+
+  /// Set the relaxed variables and postprocessors to the values from getPicardValues()
+  void setPicardValues(const std::vector<Real> & values);
+
   /// Here for backward compatibility
   FEProblem & _problem;
 
@@ -288,6 +305,13 @@ protected:
   Real _picard_rel_tol;
   Real _picard_abs_tol;
 
+  /// The variables and postprocessors the Picard acceleration is applied to
+  std::vector<VariableName> _picard_relaxed_variables;
+  std::vector<PostprocessorName> _picard_relaxed_postprocessors;
+
+  /// The Picard acceleration of the quantities transferred on TIMESTEP_BEGIN and TIMESTEP_END
+  std::map<ExecFlagType, std::unique_ptr<PicardAcceleration> > _picard_acceleration;
+
   ///should detailed diagnostic output be printed
   bool _verbose;
 
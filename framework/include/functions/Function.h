@@ -74,6 +74,21 @@ public:
    */
   virtual Real value(Real t, const Point & p);
 
+  /**
+   * The value of the function, as returned by value().  For functions that only depend on
+   * time (see isTimeOnly()) the value is computed once for each time and reused for all points.
+   * \param t The time
+   * \param p The Point in space (x,y,z)
+   * \return A scalar of the function evaluated at the time and location
+   */
+  Real cachedValue(Real t, const Point & p);
+
+  /**
+   * Override this to return true if value() depends on nothing but the time, i.e. not on the
+   * point or on values that change during a time step (postprocessors, scalar variables, etc.)
+   */
+  virtual bool isTimeOnly() const { return false; }
+
   /**
    * Override this to evaluate the vector function at a point (t,x,y,z), by default
    * this returns a zero vector, you must override it.
@@ -105,6 +120,33 @@ public:
 
   // Not defined
   virtual Real average();
+
+private:
+  /// Whether the function only depends on time: -1 if not yet asked, otherwise 0 or 1
+  int _time_only;
+
+  /// The time of the value stored by cachedValue()
+  Real _cached_time;
+
+  /// The value stored by cachedValue()
+  Real _cached_value;
 };
 
+inline Real
+Function::cachedValue(Real t, const Point & p)
+{
+  if (_time_only < 0)
+    _time_only = isTimeOnly() ? 1 : 0;
+
+  if (!_time_only)
+    return value(t, p);
+
+  if (t != _cached_time)
+  {
+    _cached_value = value(t, p);
+    _cached_time = t;
+  }
+  return _cached_value;
+}
+
 #endif //FUNCTION_H
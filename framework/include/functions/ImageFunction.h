@@ -18,6 +18,7 @@
 // MOOSE includes
 #include "Function.h"
 #include "ImageSampler.h"
+#include "MeshChangedInterface.h"
 
 // Forward declarations
 class ImageFunction;
@@ -30,7 +31,8 @@ InputParameters validParams<ImageFunction>();
  */
 class ImageFunction :
   public ImageSampler,
-  public Function
+  public Function,
+  public MeshChangedInterface
 {
 public:
 
@@ -50,6 +52,11 @@ public:
    */
   virtual void initialSetup() override;
 
+  /**
+   * Read the part of the image around the new local elements if only part of the image is read
+   */
+  virtual void meshChanged() override;
+
   /**
    * Return the pixel value for the given point
    * @param t Time (unused)
@@ -87,6 +87,12 @@ public:
    */
   virtual void initialSetup() override;
 
+  /**
+   * True if the expression does not use x, y or z and has no 'vals', which may change
+   * during a time step
+   */
+  virtual bool isTimeOnly() const override;
+
 protected:
 
   /// The function defined by the user
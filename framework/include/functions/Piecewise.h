@@ -37,6 +37,9 @@ public:
   virtual Real domain(int i);
   virtual Real range(int i);
 
+  /// Without an axis the function is a function of time
+  virtual bool isTimeOnly() const override { return !_has_axis; }
+
 protected:
   const Real _scale_factor;
   MooseSharedPointer<LinearInterpolation> _linear_interp;
@@ -72,6 +72,11 @@ private:
   const Real _scale_factor;
   const bool _radial;
 
+  ///@{ Intervals of the last lookup, successive calls usually hit the same or the next interval
+  unsigned int _x_hint;
+  unsigned int _y_hint;
+  ///@}
+
 
   void parse( std::vector<Real> & x,
               std::vector<Real> & y,
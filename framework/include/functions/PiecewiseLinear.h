@@ -51,6 +51,10 @@ public:
   virtual Real integral() override;
 
   virtual Real average() override;
+
+protected:
+  /// Interval of the last lookup, successive calls usually hit the same or the next interval
+  unsigned int _interval_hint;
 };
 
 #endif
@@ -66,6 +66,19 @@ private:
   /// the grid
   std::vector<std::vector<Real> > _grid;
 
+  /// the spacing of each axis of the grid if it is uniform, zero otherwise
+  std::vector<Real> _uniform_spacing;
+
+  /// the lower index of the interval of each axis found by the previous call to getNeighborIndices
+  std::vector<unsigned int> _bracket;
+
+  /// the offset between successive grid points along each axis in the flat function values
+  std::vector<std::size_t> _step;
+
+  /// storage for the indices of the hypercube containing the point, see sample
+  std::vector<unsigned int> _left;
+  std::vector<unsigned int> _right;
+
   /**
    * This does the core work.  Given a point, pt, defined
    * on the grid (not the MOOSE simulation reference frame),
@@ -74,17 +87,21 @@ private:
   Real sample(const std::vector<Real> & pt);
 
   /**
-   * Operates on monotonically increasing in_arr.
-   * Finds lower_x and upper_x which satisfy in_arr[lower_x] < x <= in_arr[upper_x].
+   * Operates on the monotonically increasing grid of an axis, in_arr.
+   * Finds lower_x and upper_x which satisfy in_arr[lower_x] < x <= in_arr[upper_x],
+   * or lower_x = upper_x if x is one of the grid values.
    * End conditions: if x<in_arr[0] then lower_x = 0 = upper_x is returned
    *                 if x>in_arr[N-1] then lower_x = N-1 = upper_x is returned (N=size of in_arr)
    *
-   * @param in_arr The monotonically increasing vector of real numbers
+   * The interval is computed directly for uniform axes; for other axes the interval
+   * found by the previous call is tried before searching.
+   *
+   * @param axis The axis of the grid
    * @param x The real value for which we want the neighbor indices
    * @param lower_x Upon return will contain lower_x specified above
    * @param upper_x Upon return will contain upper_x specified above
    */
-  void getNeighborIndices(std::vector<Real> in_arr, Real x, unsigned int & lower_x, unsigned int & upper_x);
+  void getNeighborIndices(unsigned int axis, Real x, unsigned int & lower_x, unsigned int & upper_x);
 };
 
 #endif //PIECEWISEMULTILINEAR_H
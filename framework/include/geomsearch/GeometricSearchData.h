@@ -65,6 +65,13 @@ public:
    */
   void update(GeometricSearchType type = ALL);
 
+  /**
+   * Update the search objects that involve one of the boundaries in moved_boundaries, the others
+   * keep the results of the previous update.  Does a full update() if search objects were added
+   * or reinitialized since the last full update.
+   */
+  void updateMovedBoundaries(const std::set<BoundaryID> & moved_boundaries);
+
   /**
    * Completely redo all geometric search objects.  This should be called when the mesh is adapted.
    */
@@ -82,6 +89,18 @@ public:
    */
   Real maxPatchPercentage();
 
+  /**
+   * Total number of slave nodes that the NearestNodeLocators found outside of their search patch.
+   *
+   * Anything but zero means the patches (and the ghosting built from them) need to be rebuilt.
+   */
+  unsigned int numSlavesOutsidePatch();
+
+  /**
+   * Estimate of the heap memory held by the penetration and nearest node locators, in bytes
+   */
+  std::size_t memoryUsage() const;
+
 //protected:
   SubProblem & _subproblem;
   MooseMesh & _mesh;
@@ -129,13 +148,19 @@ private:
   /**
    * Completely redo quadrature nodes
    */
-  void reinitQuadratureNodes(unsigned int slave_id);
+  void reinitQuadratureNodes();
 
   /**
    * Denotes whether this is the first time the geometric search objects have been updated.
    */
   bool _first;
 
+  /// The number of search objects at the last full update, zero after a reinit
+  std::size_t _n_updated_objects;
+
+  /// The number of penetration, nearest node and element pair locators
+  std::size_t nSearchObjects() const;
+
   /**
    * Update the positions of the quadrature nodes for mortar interfaces
    */
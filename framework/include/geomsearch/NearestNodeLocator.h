@@ -64,6 +64,19 @@ public:
    */
   NodeIdRange & slaveNodeRange() { return *_slave_node_range; }
 
+  /**
+   * Returns the number of slave nodes that were found to have moved out of their patch during the last
+   * findNodes() call.  Their patches have been rebuilt locally, but the ghosting still corresponds to the old
+   * patches, so a non-zero value means the patches should be fully rebuilt.  Only computed when the
+   * patch update strategy is "auto".
+   */
+  unsigned int numSlavesOutsidePatch() const { return _n_slaves_outside_patch; }
+
+  /**
+   * Estimate of the heap memory held by the nearest node data and the patches, in bytes
+   */
+  std::size_t memoryUsage() const;
+
   /**
    * Data structure used to hold nearest node info.
    */
@@ -94,6 +107,12 @@ public:
 
   std::map<dof_id_type, std::vector<dof_id_type> > _neighbor_nodes;
 
+  // The master nodes that were considered when building the patches
+  std::vector<dof_id_type> _trial_master_nodes;
+
+  // The number of slave nodes that moved out of their patch during the last search
+  unsigned int _n_slaves_outside_patch;
+
   // The following parameter controls the patch size that is searched for each nearest neighbor
   static const unsigned int _patch_size;
 
@@ -17,11 +17,25 @@
 
 #include "NearestNodeLocator.h"
 
+// Forward declarations
+class KDTree;
+
 class NearestNodeThread
 {
 public:
+  /**
+   * @param mesh The mesh
+   * @param neighbor_nodes The patch of master nodes for every slave node
+   * @param master_kd_tree Optional spatial index over the current positions of master_nodes.  If given, slave nodes
+   *                       whose nearest master node is no longer in their patch get their patch rebuilt.
+   * @param master_nodes The master nodes indexed by master_kd_tree
+   * @param patch_size The size of rebuilt patches
+   */
   NearestNodeThread(const MooseMesh & mesh,
-                    std::map<dof_id_type, std::vector<dof_id_type> > & neighbor_nodes);
+                    std::map<dof_id_type, std::vector<dof_id_type> > & neighbor_nodes,
+                    const KDTree * master_kd_tree = NULL,
+                    const std::vector<dof_id_type> * master_nodes = NULL,
+                    unsigned int patch_size = 0);
 
   // Splitting Constructor
   NearestNodeThread(NearestNodeThread & x, Threads::split split);
@@ -36,12 +50,24 @@ public:
   // The furthest percentage through the patch that had to be searched (indicative of needing to rebuild the patch)
   Real _max_patch_percentage;
 
+  // The number of slave nodes that had moved out of their patch (only counted when a spatial index is given)
+  unsigned int _n_outside_patch;
+
 protected:
   // The Mesh
   const MooseMesh & _mesh;
 
   // The neighborhood nodes associated with each node
   std::map<dof_id_type, std::vector<dof_id_type> > & _neighbor_nodes;
+
+  // Spatial index over the current positions of the master nodes
+  const KDTree * _master_kd_tree;
+
+  // The master nodes in the same order as in the spatial index
+  const std::vector<dof_id_type> * _master_nodes;
+
+  // The number of nodes in a rebuilt patch
+  unsigned int _patch_size;
 };
 
 #endif //NEARESTNODETHREAD_H
@@ -24,6 +24,9 @@
 #include "libmesh/point.h"
 #include "libmesh/fe.h"
 
+// C++ includes
+#include <map>
+
 // Forward Declarations
 class SubProblem;
 class MooseMesh;
@@ -46,6 +49,11 @@ public:
   Real penetrationDistance(dof_id_type node_id);
   RealVectorValue penetrationNormal(dof_id_type node_id);
 
+  /**
+   * Estimate of the heap memory held by the PenetrationInfo of the slave nodes, in bytes
+   */
+  std::size_t memoryUsage() const;
+
   enum NORMAL_SMOOTHING_METHOD
   {
     NSM_EDGE_BASED,
@@ -80,6 +88,14 @@ public:
   void setTangentialTolerance(Real tangential_tolerance);
   void setNormalSmoothingDistance(Real normal_smoothing_distance);
   void setNormalSmoothingMethod(std::string nsmString);
+
+  /**
+   * Keep the contact point of a slave node found at the previous search as long as the
+   * node and the face it is on have moved less than this fraction of the size of the
+   * face relative to each other.  Only the distance and the normal are then updated.
+   * Zero, the default, projects every node at every search.
+   */
+  void setReuseProjectionTolerance(Real reuse_projection_tolerance);
   Real getTangentialTolerance() {return _tangential_tolerance;}
 
 protected:
@@ -90,6 +106,12 @@ protected:
   bool _do_normal_smoothing;  // Should we do contact normal smoothing?
   Real _normal_smoothing_distance; // Distance from edge (in parametric coords) within which to perform normal smoothing
   NORMAL_SMOOTHING_METHOD _normal_smoothing_method;
+
+  /// Relative motion below which projections are kept, see setReuseProjectionTolerance()
+  Real _reuse_projection_tolerance;
+
+  /// The positions of each slave node and of the nodes of its face when it was last projected
+  std::map<dof_id_type, std::vector<Point> > _projection_positions;
 };
 
 /**
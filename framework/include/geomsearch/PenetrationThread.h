@@ -18,6 +18,7 @@
 // MOOSE includes
 #include "PenetrationLocator.h"
 #include "ParallelUniqueId.h"
+#include "NodeElemAdjacency.h"
 
 // Forward declarations
 class MooseVariable;
@@ -40,10 +41,12 @@ public:
                     std::vector<std::vector<FEBase *> > & fes,
                     FEType & fe_type,
                     NearestNodeLocator & nearest_node,
-                    const std::map<dof_id_type, std::vector<dof_id_type> > & node_to_elem_map,
+                    const NodeElemAdjacency & node_to_elem_map,
                     std::vector<dof_id_type> & elem_list,
                     std::vector<unsigned short int> & side_list,
-                    std::vector<boundary_id_type> & id_list);
+                    std::vector<boundary_id_type> & id_list,
+                    Real reuse_projection_tolerance,
+                    std::map<dof_id_type, std::vector<Point> > & projection_positions);
 
   // Splitting Constructor
   PenetrationThread(PenetrationThread & x, Threads::split split);
@@ -78,7 +81,7 @@ protected:
 
   NearestNodeLocator & _nearest_node;
 
-  const std::map<dof_id_type, std::vector<dof_id_type> > & _node_to_elem_map;
+  const NodeElemAdjacency & _node_to_elem_map;
 
   std::vector<dof_id_type> & _elem_list;
   std::vector<unsigned short int> & _side_list;
@@ -86,6 +89,12 @@ protected:
 
   unsigned int _n_elems;
 
+  /// Relative motion, as a fraction of the face size, below which the last projection is kept (0 to always project)
+  Real _reuse_projection_tolerance;
+
+  /// The positions of the slave node and of the face nodes when each node was last projected
+  std::map<dof_id_type, std::vector<Point> > & _projection_positions;
+
   THREAD_ID _tid;
 
   enum CompeteInteractionResult
@@ -176,7 +185,8 @@ protected:
                     const Node* slave_node,
                     const Elem* elem,
                     const std::vector<const Node*> &nodes_that_must_be_on_side,
-                    const bool check_whether_reasonable = false);
+                    const bool check_whether_reasonable = false,
+                    const PenetrationInfo * previous_info = NULL);
 
   void
   getSidesOnMasterBoundary(std::vector<unsigned int> &sides,
@@ -186,6 +196,28 @@ protected:
   computeSlip( FEBase & fe,
                PenetrationInfo & info );
 
+  /**
+   * Whether the contact point of info can be kept: it must be inside the face, and the
+   * face nodes must have moved less than the tolerance relative to the slave node
+   * since the positions were stored.
+   */
+  bool
+  canReuseProjection(const PenetrationInfo & info,
+                     const Node & node,
+                     const std::vector<Point> & positions);
+
+  /// Stores the positions of the slave node and of the face nodes after a projection
+  void
+  storeProjectionPositions(const PenetrationInfo & info,
+                           const Node & node,
+                           std::vector<Point> & positions);
+
+  /// Updates the closest point, normal, distance and shape functions of info at its reference coordinates
+  void
+  updateInfoAtReference(PenetrationInfo & info,
+                        FEBase & fe,
+                        const Node & node);
+
   void
   switchInfo( PenetrationInfo * & info,
               PenetrationInfo * & infoNew );
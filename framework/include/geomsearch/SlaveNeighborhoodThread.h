@@ -17,17 +17,20 @@
 
 // MOOSE includes
 #include "MooseTypes.h"
+#include "NodeElemAdjacency.h"
 
 // Forward declarations
 class MooseMesh;
+class KDTree;
 
 class SlaveNeighborhoodThread
 {
 public:
   SlaveNeighborhoodThread(const MooseMesh & mesh,
                           const std::vector<dof_id_type> & trial_master_nodes,
-                          const std::map<dof_id_type, std::vector<dof_id_type> > & node_to_elem_map,
-                          const unsigned int patch_size);
+                          const NodeElemAdjacency & node_to_elem_map,
+                          const unsigned int patch_size,
+                          const KDTree * kd_tree = NULL);
 
 
   /// Splitting Constructor
@@ -54,10 +57,13 @@ protected:
   const std::vector<dof_id_type> & _trial_master_nodes;
 
   /// Node to elem map
-  const std::map<dof_id_type, std::vector<dof_id_type> > & _node_to_elem_map;
+  const NodeElemAdjacency & _node_to_elem_map;
 
   /// The number of nodes to keep
   unsigned int _patch_size;
+
+  /// Optional spatial index over the trial master nodes (in the same order) used instead of the brute force search
+  const KDTree * _kd_tree;
 };
 
 #endif //SLAVENEIGHBORHOODTHREAD_H
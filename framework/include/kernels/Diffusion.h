@@ -35,6 +35,9 @@ protected:
   virtual Real computeQpResidual() override;
 
   virtual Real computeQpJacobian() override;
+
+  virtual bool hasJacobianCoefficients(unsigned int jvar) override;
+  virtual void computeQpJacobianCoefficients(unsigned int jvar, RealTensorValue & D, RealVectorValue & b, Real & c) override;
 };
 
 
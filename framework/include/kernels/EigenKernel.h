@@ -45,6 +45,9 @@ protected:
   virtual Real computeQpResidual() = 0;
   virtual Real computeQpJacobian();
 
+  /// The factor 1/k applied to the residual, accounting for a Wielandt shift of the eigen system
+  Real oneOverEigenvalue();
+
   /// Holds the solution at current quadrature points
   const VariableValue & _u;
 
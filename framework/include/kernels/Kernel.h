@@ -17,6 +17,9 @@
 
 #include "KernelBase.h"
 
+// libMesh includes
+#include "libmesh/tensor_value.h"
+
 class Kernel;
 
 template<>
@@ -48,6 +51,25 @@ protected:
   virtual void precalculateJacobian() {}
   virtual void precalculateOffDiagJacobian(unsigned int /* jvar */) {}
 
+  /**
+   * Whether the Jacobian block of jvar is given by computeQpJacobianCoefficients() rather than
+   * by computeQpJacobian() or computeQpOffDiagJacobian().  The block is then formed as one dense
+   * product over all quadrature points instead of one virtual call per entry.  Since derived
+   * classes may change the Jacobian, kernels should only return true if typeid(*this) is their
+   * own class.
+   */
+  virtual bool hasJacobianCoefficients(unsigned int /* jvar */) { return false; }
+
+  /**
+   * The coefficients of the Jacobian block of jvar at the current quadrature point, with
+   *   dR_i/du_j = grad_test_i . (D grad_phi_j + b phi_j) + c test_i phi_j
+   * D, b and c are zero on entry.
+   */
+  virtual void computeQpJacobianCoefficients(unsigned int /* jvar */, RealTensorValue & /* D */, RealVectorValue & /* b */, Real & /* c */) {}
+
+  /// Add the Jacobian block of jvar given by computeQpJacobianCoefficients() to ke
+  void computeCoefficientJacobian(unsigned int jvar, DenseMatrix<Number> & ke);
+
   /// Holds the solution at current quadrature points
   const VariableValue & _u;
 
@@ -59,6 +81,12 @@ protected:
 
   /// Derivative of u_dot with respect to u
   const VariableValue & _du_dot_du;
+
+private:
+  ///@{ The test functions and the weighted shape function terms of computeCoefficientJacobian(), one row per qp and component
+  std::vector<Real> _coef_test;
+  std::vector<Real> _coef_phi;
+  ///@}
 };
 
 #endif /* KERNEL_H */
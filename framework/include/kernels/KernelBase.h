@@ -99,7 +99,21 @@ public:
   /// Returns a reference to the SubProblem for which this Kernel is active
   SubProblem & subProblem();
 
+  /**
+   * Whether this Kernel contributes to the Jacobian block of the nonlinear variable jvar.  With
+   * "skip_uncoupled_jacobian" these are its own variable, the coupled variables and the
+   * "off_diagonal_variables", and the other off-diagonal blocks are not computed.  Otherwise the
+   * Kernel may contribute to every block (e.g. through material property derivatives).
+   */
+  bool isJacobianCoupled(unsigned int jvar) const;
+
 protected:
+  /**
+   * Declare a contribution to the Jacobian block of the nonlinear variable jvar, for derived
+   * classes that compute off-diagonal Jacobian entries for variables they do not couple.
+   */
+  void addJacobianCoupling(unsigned int jvar);
+
   /// Reference to this kernel's SubProblem
   SubProblem & _subproblem;
 
@@ -174,6 +188,12 @@ protected:
   bool _has_diag_save_in;
   std::vector<MooseVariable*> _diag_save_in;
   std::vector<AuxVariableName> _diag_save_in_strings;
+
+  /// Whether the off-diagonal Jacobian blocks of the variables this Kernel does not declare are skipped
+  const bool _skip_uncoupled_jacobian;
+
+  /// Whether this Kernel contributes to the Jacobian block of each nonlinear variable number
+  std::vector<bool> _jacobian_coupled;
 };
 
 #endif /* KERNELBASE_H */
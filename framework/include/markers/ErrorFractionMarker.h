@@ -40,6 +40,9 @@ protected:
   Real _delta;
   Real _refine_cutoff;
   Real _coarsen_cutoff;
+
+  /// The min and max error over the whole mesh
+  const std::pair<Real, Real> & _error_range;
 };
 
 #endif /* ERRORFRACTIONMARKER_H */
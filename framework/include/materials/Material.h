@@ -175,6 +175,11 @@ public:
    */
   bool isBoundaryMaterial() const { return _bnd; }
 
+  /**
+   * Returns true if this material declares stateful (old or older) properties
+   */
+  bool hasStatefulProperties() const { return _has_stateful_property; }
+
 protected:
 
   /**
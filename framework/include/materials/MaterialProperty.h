@@ -81,6 +81,15 @@ public:
    */
   virtual void qpCopy (const unsigned int to_qp, PropertyValue *rhs, const unsigned int from_qp) = 0;
 
+  /**
+   * Copy the values at several qps of a Property into this Property: qp i of this Property gets
+   * the value at qp from_qps[i] of rhs.
+   *
+   * @param rhs The Property you want to copy _from_.
+   * @param from_qps The quadrature points in rhs you want to copy _from_, one for each qp of this Property to copy _to_.
+   */
+  virtual void qpCopy (PropertyValue *rhs, const std::vector<unsigned int> & from_qps) = 0;
+
   // save/restore in a file
   virtual void store(std::ostream & stream) = 0;
   virtual void load(std::istream & stream) = 0;
@@ -168,6 +177,15 @@ public:
    */
   virtual void qpCopy (const unsigned int to_qp, PropertyValue *rhs, const unsigned int from_qp);
 
+  /**
+   * Copy the values at several qps of a Property into this Property: qp i of this Property gets
+   * the value at qp from_qps[i] of rhs.
+   *
+   * @param rhs The Property you want to copy _from_.
+   * @param from_qps The quadrature points in rhs you want to copy _from_, one for each qp of this Property to copy _to_.
+   */
+  virtual void qpCopy (PropertyValue *rhs, const std::vector<unsigned int> & from_qps);
+
   /**
    * Store the property into a binary stream
    */
@@ -248,10 +266,28 @@ MaterialProperty<T>::qpCopy (const unsigned int to_qp, PropertyValue *rhs, const
   _value[to_qp] = cast_ptr<const MaterialProperty<T>*>(rhs)->_value[from_qp];
 }
 
+template <typename T>
+inline void
+MaterialProperty<T>::qpCopy (PropertyValue *rhs, const std::vector<unsigned int> & from_qps)
+{
+  mooseAssert(rhs != NULL, "Assigning NULL?");
+  mooseAssert(from_qps.size() <= _value.size(), "Copying more qps than the property has");
+  const MooseArray<T> & rhs_value = cast_ptr<const MaterialProperty<T>*>(rhs)->_value;
+  for (unsigned int qp = 0; qp < from_qps.size(); ++qp)
+    _value[qp] = rhs_value[from_qps[qp]];
+}
+
 template<typename T>
 inline void
 MaterialProperty<T>::store(std::ostream & stream)
 {
+  if (DataIOBlockCopyable<T>::value)
+  {
+    if (_value.size() > 0)
+      stream.write((char *) &_value[0], _value.size() * sizeof(T));
+    return;
+  }
+
   for (unsigned int i = 0; i < _value.size(); i++)
     storeHelper(stream, _value[i], NULL);
 }
@@ -260,6 +296,13 @@ template<typename T>
 inline void
 MaterialProperty<T>::load(std::istream & stream)
 {
+  if (DataIOBlockCopyable<T>::value)
+  {
+    if (_value.size() > 0)
+      stream.read((char *) &_value[0], _value.size() * sizeof(T));
+    return;
+  }
+
   for (unsigned int i = 0; i < _value.size(); i++)
     loadHelper(stream, _value[i], NULL);
 }
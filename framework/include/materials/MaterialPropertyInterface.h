@@ -175,6 +175,12 @@ public:
    */
   bool getMaterialPropertyCalled() const { return _get_material_property_called; }
 
+  /**
+   * Retrieve the set of material properties that _this_ object depends on.
+   * @return The names of the material properties that MUST be computed before evaluating this object
+   */
+  const std::set<std::string> & getMatPropDependencies() const { return _material_property_dependencies; }
+
 protected:
   /// Parameters of the object with this interface
   const InputParameters & _mi_params;
@@ -239,6 +245,9 @@ protected:
    */
   bool _get_material_property_called;
 
+  /// The set of material properties (as names) this object depends on
+  std::set<std::string> _material_property_dependencies;
+
   /// Storage vector for MaterialProperty<Real> default objects
   std::vector<MooseSharedPointer<MaterialProperty<Real> > > _default_real_properties;
 
@@ -404,6 +413,8 @@ MaterialPropertyInterface::getBlockMaterialProperty(const MaterialPropertyName &
   if (!hasMaterialPropertyByName<T>(name))
     return std::pair<const MaterialProperty<T> *, std::set<SubdomainID> >(NULL, std::set<SubdomainID>());
 
+  _material_property_dependencies.insert(name);
+
   return std::pair<const MaterialProperty<T> *, std::set<SubdomainID> >(&_material_data->getProperty<T>(name), _mi_feproblem.getMaterialPropertyBlocks(name));
 }
 
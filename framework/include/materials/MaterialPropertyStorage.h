@@ -128,6 +128,25 @@ public:
    */
   void copy(MaterialData & material_data, const Elem & elem_to, const Elem & elem_from, unsigned int side, unsigned int n_qpoints);
 
+  /**
+   * Write the stateful properties of all the sides of an element, for moving them to another
+   * processor with unpackElem()
+   */
+  void packElem(std::ostream & stream, const Elem & elem);
+
+  /**
+   * Read the properties of an element written by packElem(), creating the storage as needed
+   * @param stream The stream to read from
+   * @param material_data MaterialData object that has the properties to create the storage from
+   * @param elem The element the properties were packed for
+   */
+  void unpackElem(std::istream & stream, MaterialData & material_data, const Elem & elem);
+
+  /**
+   * Release the stored properties of all the sides of an element
+   */
+  void eraseElem(const Elem & elem);
+
   /**
    * Swap (shallow copy) material properties in MaterialData and MaterialPropertyStorage
    * Thread safe
@@ -179,6 +198,41 @@ public:
 
   unsigned int getPropertyId (const std::string & prop_name);
 
+  /**
+   * Enable or disable the flat element index used by swap() and swapBack().  When enabled the
+   * per element/side MaterialProperties are cached in a vector indexed by element id and side so that
+   * the hot swap calls in the residual and Jacobian loops do not need to go through the HashMaps.
+   */
+  void setFlatIndexing(bool flat_indexing);
+
+  /// @return true if the flat element index is being used
+  bool hasFlatIndexing() const { return _flat_indexing; }
+
+  /// The storage used by one stateful property on this processor
+  struct StatefulMemory
+  {
+    StatefulMemory() : n_states(0), n_qps(0), bytes_per_qp(0) {}
+
+    /// Name of the property
+    std::string name;
+
+    /// Number of stored states (current and old, plus older if any property needs it)
+    unsigned int n_states;
+
+    /// Number of qps stored in each state, summed over the elements and sides
+    std::size_t n_qps;
+
+    /// Size of the value at one qp, as written by PropertyValue::store(); 0 if nothing is stored
+    std::size_t bytes_per_qp;
+  };
+
+  /**
+   * The storage used by each stateful property, in the order of statefulProps().
+   * The size of a qp is measured by serializing the first stored value, so it includes
+   * the dynamically allocated data of types such as std::vector.
+   */
+  std::vector<StatefulMemory> statefulMemory() const;
+
 protected:
   // indexing: [element][side]->material_properties
   HashMap<const Elem *, HashMap<unsigned int, MaterialProperties> > * _props_elem;
@@ -210,6 +264,36 @@ protected:
   unsigned int addPropertyId (const std::string & prop_name);
 
   void sizeProps(MaterialProperties & mp, unsigned int size);
+
+  /**
+   * Entry of the flat element index: pointers into the three HashMaps for one element/side.
+   * The props array is indexed by physical storage slot, see _flat_slot.
+   */
+  struct FlatEntry
+  {
+    FlatEntry() : _elem(NULL) { _props[0] = _props[1] = _props[2] = NULL; }
+
+    const Elem * _elem;
+    MaterialProperties * _props[3];
+  };
+
+  /**
+   * Return the flat index entry for the passed element/side, populating it from the HashMaps if needed.
+   * Must be called with Threads::spin_mtx held.
+   */
+  FlatEntry & flatEntry(const Elem & elem, unsigned int side);
+
+  /// Whether or not the flat element index is used
+  bool _flat_indexing;
+
+  /// Flat element index: [elem_id * _flat_max_sides + side]
+  std::vector<FlatEntry> _flat_props;
+
+  /// Storage slot of the current, old and older properties (rotated in shift() along with the HashMap pointers)
+  unsigned int _flat_slot[3];
+
+  /// Elements with more sides than this are handled through the HashMaps only
+  static const unsigned int _flat_max_sides = 6;
 };
 
 template<>
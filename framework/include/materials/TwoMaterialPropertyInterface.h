@@ -71,8 +71,9 @@ TwoMaterialPropertyInterface::getNeighborMaterialProperty(const std::string & na
   const MaterialProperty<T> * default_property = defaultMaterialProperty<T>(prop_name);
   if (default_property)
     return *default_property;
-  else
-    return _neighbor_material_data->getProperty<T>(prop_name);
+
+  _material_property_dependencies.insert(prop_name);
+  return _neighbor_material_data->getProperty<T>(prop_name);
 }
 
 template<typename T>
@@ -86,8 +87,9 @@ TwoMaterialPropertyInterface::getNeighborMaterialPropertyOld(const std::string &
   const MaterialProperty<T> * default_property = defaultMaterialProperty<T>(prop_name);
   if (default_property)
     return *default_property;
-  else
-    return _neighbor_material_data->getPropertyOld<T>(prop_name);
+
+  _material_property_dependencies.insert(prop_name);
+  return _neighbor_material_data->getPropertyOld<T>(prop_name);
 }
 
 template<typename T>
@@ -101,8 +103,9 @@ TwoMaterialPropertyInterface::getNeighborMaterialPropertyOlder(const std::string
   const MaterialProperty<T> * default_property = defaultMaterialProperty<T>(prop_name);
   if (default_property)
     return *default_property;
-  else
-    return _neighbor_material_data->getPropertyOlder<T>(prop_name);
+
+  _material_property_dependencies.insert(prop_name);
+  return _neighbor_material_data->getPropertyOlder<T>(prop_name);
 }
 
 #endif //TWOMATERIALPROPERTYINTERFACE_H
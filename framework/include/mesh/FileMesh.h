@@ -42,8 +42,24 @@ public:
   const std::string & getFileName() const { return _file_name; }
 
 protected:
+  /// The name of the split cache on this number of processors
+  std::string splitCacheName() const;
+
+  /**
+   * Read the mesh from the split cache if it is up to date
+   * @return true if the mesh was read
+   */
+  bool readSplitCache();
+
+  /// Write the prepared mesh to the split cache
+  void writeSplitCache();
+
   /// the file_name from whence this mesh came
   std::string _file_name;
+
+  /// Whether the partitioned mesh is kept in a binary cache
+  const bool _split_cache;
+
   /// Auxiliary object for restart
   std::unique_ptr<ExodusII_IO> _exreader;
 };
@@ -39,6 +39,19 @@ public:
   virtual void buildMesh() override;
 
 protected:
+  /**
+   * Build only the brick of elements owned by this processor and the layer of elements
+   * around it, directly in the DistributedMesh, with the same ids build_line/square/cube
+   * would give them.
+   */
+  void buildDistributedMesh(ElemType elem_type);
+
+  /**
+   * Split the processors into a grid of bricks with the smallest total brick surface
+   * @param n_bricks The number of bricks in each direction (output)
+   */
+  void processorGrid(unsigned int n_bricks[3]) const;
+
   /// The dimension of the mesh
   MooseEnum _dim;
 
@@ -61,6 +74,9 @@ protected:
   /// _bias_x==1 implies no bias (original mesh unchanged).
   /// _bias_x > 1 implies cells are growing in the x-direction.
   Real _bias_x, _bias_y, _bias_z;
+
+  /// Whether each processor generates only its own part of a DistributedMesh
+  bool _distributed_generation;
 };
 
 #endif /* GENERATEDMESH_H */
@@ -18,10 +18,12 @@
 #include "MooseObject.h"
 #include "BndNode.h"
 #include "BndElement.h"
+#include "NodeElemAdjacency.h"
 #include "Restartable.h"
 #include "MooseEnum.h"
 
 #include <memory> //std::unique_ptr
+#include <deque>
 
 // libMesh
 #include "libmesh/mesh.h"
@@ -49,6 +51,38 @@ typedef StoredRange<std::set<Node *>::iterator, Node*> SemiLocalNodeRange;
 template<>
 InputParameters validParams<MooseMesh>();
 
+/**
+ * A built mesh shared by the sub-apps of a MultiApp created from the same input file
+ * (MultiApp/share_mesh).  The first app stores a copy of its mesh right after building it, the
+ * next ones copy it instead of reading or generating their own.  With
+ * MultiApp/share_initial_condition the projected initial condition is shared the same way.
+ */
+struct MeshTemplate
+{
+  MeshTemplate() : share_initial_condition(false), has_initial_solution(false), initial_solution_time(0) {}
+
+  /// The copy of the built mesh, NULL until the first app has built it
+  std::unique_ptr<MeshBase> mesh;
+
+  /// The communicator of the app that built the mesh, which the copy still refers to
+  MooseSharedPointer<Parallel::Communicator> comm;
+
+  /// Whether the apps also share the projected initial condition
+  bool share_initial_condition;
+
+  /// True once the first app has stored its projected initial condition
+  bool has_initial_solution;
+
+  /// The time the stored initial condition was projected at, the ICs may depend on it
+  Real initial_solution_time;
+
+  ///@{
+  /// The local entries of the projected nonlinear and auxiliary solutions
+  std::vector<Number> nl_initial_solution;
+  std::vector<Number> aux_initial_solution;
+  ///@}
+};
+
 /**
  * Helper object for holding qp mapping info.
  */
@@ -153,7 +187,7 @@ public:
    * If not already created, creates a map from every node to all
    * elements to which they are connected.
    */
-  const std::map<dof_id_type, std::vector<dof_id_type> > & nodeToElemMap();
+  const NodeElemAdjacency & nodeToElemMap();
 
   /**
    * If not already created, creates a map from every node to all
@@ -162,7 +196,14 @@ public:
    * one node with a local element.
    * \note Extra ghosted elements are not included in this map!
    */
-  const std::map<dof_id_type, std::vector<dof_id_type> > & nodeToActiveSemilocalElemMap();
+  const NodeElemAdjacency & nodeToActiveSemilocalElemMap();
+
+  /**
+   * Estimate of the heap memory held by the lists and maps that MooseMesh builds on top of
+   * the libMesh mesh (the node to element maps, the boundary node and element lists, the
+   * quadrature nodes and the node sets), in bytes.  The libMesh mesh itself is not included.
+   */
+  std::size_t auxiliaryMemoryUsage() const;
 
   /**
    * These structs are required so that the bndNodes{Begin,End} and
@@ -412,6 +453,14 @@ public:
    */
   void ghostGhostedBoundaries();
 
+  /**
+   * When true, ghostGhostedBoundaries() only ghosts the boundary elements whose bounding
+   * box intersects the bounding box of this processor inflated by the ghosted boundary
+   * inflation, instead of the whole boundaries.  This keeps the memory and communication
+   * of the contact search proportional to the boundary near each processor.
+   */
+  void setGhostBoundariesByProximity(bool state);
+
   /**
    * Getter/setter for the patch_size parameter.
    */
@@ -505,6 +554,21 @@ public:
    */
   void clearQuadratureNodes();
 
+  /**
+   * Start adding the quadrature nodes again after the mesh changed.  The calls to
+   * addQuadratureNode() that follow reuse the existing node of the same element side and
+   * qp, with its id, instead of creating a new one.
+   */
+  void beginQuadratureNodeReuse();
+
+  /**
+   * Finish adding the quadrature nodes began by beginQuadratureNodeReuse() and rebuild
+   * the boundary node lists.
+   * @return false if some existing quadrature nodes were not added again; they are still
+   * stored, so call clearQuadratureNodes() and add the nodes again to release them.
+   */
+  bool finishQuadratureNodeReuse();
+
   /**
    * Get the associated BoundaryID for the boundary name.
    *
@@ -549,7 +613,8 @@ public:
 
   /**
    * This routine builds a multimap of boundary ids to matching boundary ids across all periodic boundaries
-   * in the system.
+   * in the system.  The matching nodes are looked up in a hashed index of the positions of the nodes of
+   * the paired boundaries, so this is linear in the number of boundary nodes.
    */
   void buildPeriodicNodeMap(std::multimap<dof_id_type, dof_id_type> & periodic_node_map, unsigned int var_number, PeriodicBoundaries *pbs) const;
 
@@ -637,7 +702,7 @@ public:
    * @param child The child number (-1 if not mapping child internal sides)
    * @param child_side The side number of the child (-1 if not mapping sides)
    */
-  const std::vector<std::vector<QpMap> > & getRefinementMap(const Elem & elem, int parent_side, int child, int child_side);
+  const std::vector<std::vector<QpMap> > & getRefinementMap(const Elem & elem, int parent_side, int child, int child_side) const;
 
   /**
    * Get the coarsening map for a given element type.  This will tell you what quadrature points
@@ -646,7 +711,7 @@ public:
    * @param elem The element that represents the element type you need the coarsening map for.
    * @param input_side The side to map
    */
-  const std::vector<std::pair<unsigned int, QpMap> > & getCoarseningMap(const Elem & elem, int input_side);
+  const std::vector<std::pair<unsigned int, QpMap> > & getCoarseningMap(const Elem & elem, int input_side) const;
 
   /**
    * Change all the boundary IDs for a given side from old_id to
@@ -796,6 +861,9 @@ protected:
   MooseEnum _partitioner_name;
   bool _partitioner_overridden;
 
+  /// The space-filling curve the elements and nodes are numbered along ("none" keeps the file numbering)
+  MooseEnum _ordering;
+
   /// The custom partitioner
   std::unique_ptr<Partitioner> _custom_partitioner;
   bool _custom_partitioner_requested;
@@ -851,11 +919,11 @@ protected:
   std::unique_ptr<StoredRange<MooseMesh::const_bnd_elem_iterator, const BndElement*> > _bnd_elem_range;
 
   /// A map of all of the current nodes to the elements that they are connected to.
-  std::map<dof_id_type, std::vector<dof_id_type> > _node_to_elem_map;
+  NodeElemAdjacency _node_to_elem_map;
   bool _node_to_elem_map_built;
 
   /// A map of all of the current nodes to the active elements that they are connected to.
-  std::map<dof_id_type, std::vector<dof_id_type> > _node_to_active_semilocal_elem_map;
+  NodeElemAdjacency _node_to_active_semilocal_elem_map;
   bool _node_to_active_semilocal_elem_map_built;
 
   /**
@@ -880,26 +948,50 @@ protected:
   /// The boundary to normal map - valid only when AddAllSideSetsByNormals is active
   std::unique_ptr<std::map<BoundaryID, RealVectorValue> > _boundary_to_normal_map;
 
-  /// array of boundary nodes
+  /**
+   * The boundary nodes, by value in one array sorted by boundary id and node id, so that the
+   * nodes of a boundary are contiguous and can be searched.
+   */
+  std::vector<BndNode> _bnd_node_storage;
+  /// The boundary nodes of the quadrature nodes added by addQuadratureNode() since the list was built
+  std::vector<std::unique_ptr<BndNode> > _added_bnd_nodes;
+  /// array of boundary nodes, pointing into _bnd_node_storage followed by _added_bnd_nodes
   std::vector<BndNode *> _bnd_nodes;
   typedef std::vector<BndNode *>::iterator             bnd_node_iterator_imp;
   typedef std::vector<BndNode *>::const_iterator const_bnd_node_iterator_imp;
-  /// Map of sets of node IDs in each boundary
-  std::map<boundary_id_type, std::set<dof_id_type> > _bnd_node_ids;
-
-  /// array of boundary elems
+  /// The [begin, end) positions of each boundary in _bnd_node_storage
+  std::map<boundary_id_type, std::pair<std::size_t, std::size_t> > _bnd_node_offsets;
+  /// Map of sets of the node IDs in _added_bnd_nodes on each boundary
+  std::map<boundary_id_type, std::set<dof_id_type> > _added_bnd_node_ids;
+  /// True for the ids (below the max node id of the mesh) of the nodes in _bnd_node_storage
+  std::vector<bool> _bnd_node_flags;
+
+  /// The boundary element sides, by value in one array sorted by boundary id, element id and side
+  std::vector<BndElement> _bnd_elem_storage;
+  /// array of boundary elems, pointing into _bnd_elem_storage
   std::vector<BndElement *> _bnd_elems;
   typedef std::vector<BndElement *>::iterator             bnd_elem_iterator_imp;
   typedef std::vector<BndElement *>::const_iterator const_bnd_elem_iterator_imp;
-  /// Map of set of elem IDs connected to each boundary
-  std::map<boundary_id_type, std::set<dof_id_type> > _bnd_elem_ids;
+  /// The [begin, end) positions of each boundary in _bnd_elem_storage
+  std::map<boundary_id_type, std::pair<std::size_t, std::size_t> > _bnd_elem_offsets;
+  /// True for the ids of the elements in _bnd_elem_storage
+  std::vector<bool> _bnd_elem_flags;
+
+  /// The quadrature nodes; a deque so that the nodes never move.  The node at index i has id quadratureNodeId(i).
+  std::deque<Node> _quadrature_nodes;
 
-  std::map<dof_id_type, Node *> _quadrature_nodes;
-  std::map<dof_id_type, std::map<unsigned int, std::map<dof_id_type, Node *> > > _elem_to_side_to_qp_to_quadrature_nodes;
+  /// The quadrature nodes of each element side (the side is 0 for mortar element), indexed by qp
+  std::map<std::pair<dof_id_type, unsigned short int>, std::vector<Node *> > _elem_side_to_quadrature_nodes;
+
+  /// The quadrature nodes that addQuadratureNode() can reuse, see beginQuadratureNodeReuse()
+  std::map<std::pair<dof_id_type, unsigned short int>, std::vector<Node *> > _reusable_quadrature_nodes;
   std::vector<BndNode> _extra_bnd_nodes;
 
-  /// list of nodes that belongs to a specified block (domain)
-  std::map<dof_id_type, std::set<SubdomainID> > _block_node_list;
+  /// The distinct sets of blocks (domains) that the nodes belong to
+  std::vector<std::set<SubdomainID> > _node_block_sets;
+
+  /// The index in _node_block_sets of the blocks of each node, by row of _node_to_elem_map
+  std::vector<unsigned int> _node_block_set_index;
 
   /// list of nodes that belongs to a specified nodeset: indexing [nodeset_id] -> [array of node ids]
   std::map<boundary_id_type, std::vector<dof_id_type> > _node_set_nodes;
@@ -907,6 +999,9 @@ protected:
   std::set<unsigned int> _ghosted_boundaries;
   std::vector<Real> _ghosted_boundaries_inflation;
 
+  /// Whether only the ghosted boundary elements near each processor get ghosted there
+  bool _ghost_boundaries_by_proximity;
+
   /// The number of nodes to consider in the NearestNode neighborhood.
   unsigned int _patch_size;
 
@@ -936,8 +1031,31 @@ protected:
 
   void cacheInfo();
   void freeBndNodes();
+
+  /// The id of the quadrature node stored at index in _quadrature_nodes
+  static dof_id_type quadratureNodeId(std::size_t index);
+
+  /// The index in _quadrature_nodes of the quadrature node with the given id
+  static std::size_t quadratureNodeIndex(dof_id_type id);
   void freeBndElems();
 
+  /// Ghost each of boundary_elems owned by this processor to the processors whose inflated bounding box it intersects
+  void ghostBoundaryElemsByProximity(const std::set<const Elem *> & boundary_elems);
+
+  /**
+   * Renumber the elements by processor and then along the space-filling curve of Mesh/ordering
+   * through their centroids, and the nodes in the order the elements reach them.  The local
+   * element loops and the DOF numbering follow the ids, so neighboring elements share their
+   * nodal data in the cache.  Only done for replicated, unrefined meshes.
+   */
+  void reorderAlongCurve();
+
+  /**
+   * Build the mesh as a copy of the mesh of another sub-app created from the same input
+   * (MultiApp/share_mesh) instead of calling buildMesh().
+   */
+  void copyMeshTemplate(const MeshBase & mesh_template);
+
 private:
   /**
    * A map of vectors indicating which dimensions are periodic in a regular orthogonal mesh for
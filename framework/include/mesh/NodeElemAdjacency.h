@@ -0,0 +1,180 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef NODEELEMADJACENCY_H
+#define NODEELEMADJACENCY_H
+
+#include "MooseTypes.h"
+
+// libMesh includes
+#include "libmesh/mesh_base.h"
+
+// C++ includes
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <utility>
+#include <vector>
+
+/**
+ * The elements connected to each node of a mesh, in compressed row storage:
+ * the ids of all elements are kept in one contiguous array, and the elements of
+ * the node in row r are _elems[_offsets[r]] to _elems[_offsets[r+1]].
+ *
+ * When most of the ids up to the largest node id are stored on this processor
+ * (always the case for a ReplicatedMesh) the row of a node is its id.
+ * Otherwise the rows are the positions of the node ids in a sorted array,
+ * so a DistributedMesh only pays for the nodes it stores.
+ *
+ * The elements of a node are in increasing id, the order of the mesh element
+ * iterators.  Nodes that are not in the mesh, such as the quadrature nodes of
+ * MooseMesh, can be added afterwards with addElem().
+ *
+ * find() and end() mimic a std::map<dof_id_type, std::vector<dof_id_type> >
+ * so that find(id)->second can be used as the vector of elements of a node;
+ * nodes without elements are not found.
+ */
+class NodeElemAdjacency
+{
+public:
+  /// A range of element ids
+  struct ElemRange
+  {
+    const dof_id_type * first;
+    const dof_id_type * last;
+
+    const dof_id_type * begin() const { return first; }
+    const dof_id_type * end() const { return last; }
+    std::size_t size() const { return last - first; }
+    bool empty() const { return first == last; }
+    const dof_id_type & operator[](std::size_t i) const { return first[i]; }
+  };
+
+  /// The result of find(): behaves like a std::map iterator, but cannot be incremented
+  class const_iterator
+  {
+  public:
+    const_iterator(dof_id_type node_id, const ElemRange & range) : _value(node_id, range) {}
+
+    const std::pair<dof_id_type, ElemRange> & operator*() const { return _value; }
+    const std::pair<dof_id_type, ElemRange> * operator->() const { return &_value; }
+
+    bool operator==(const const_iterator & other) const { return _value.second.first == other._value.second.first; }
+    bool operator!=(const const_iterator & other) const { return !(*this == other); }
+
+  private:
+    std::pair<dof_id_type, ElemRange> _value;
+  };
+
+  /// The value of localIndex() for nodes that do not have a row
+  static const std::size_t invalid_index;
+
+  NodeElemAdjacency();
+
+  /// Build the adjacency of all the elements of mesh, replacing the rows of any previous data
+  void build(const MeshBase & mesh);
+
+  /**
+   * Build the adjacency of the elements in [begin, end), which must be elements of mesh,
+   * replacing the rows of any previous data.  The elements added by addElem() are kept.
+   * @param active_only Skip the elements that are not active
+   */
+  void build(const MeshBase & mesh, MeshBase::const_element_iterator begin,
+             const MeshBase::const_element_iterator & end, bool active_only);
+
+  /**
+   * Connect an element to a node that is not in the mesh, unless it already is connected.
+   * This is meant for the few nodes that are added after the adjacency has been built,
+   * which are kept in a std::map.
+   */
+  void addElem(dof_id_type node_id, dof_id_type elem_id);
+
+  /// Release all the data, including the elements added by addElem()
+  void clear();
+
+  /// Estimate of the heap memory held by the adjacency, in bytes
+  std::size_t memoryUsage() const;
+
+  /// The row of a node, or invalid_index if the node is not in the mesh
+  std::size_t localIndex(dof_id_type node_id) const
+  {
+    if (_node_ids.empty())
+      return node_id + 1 < _offsets.size() ? node_id : invalid_index;
+
+    std::vector<dof_id_type>::const_iterator it = std::lower_bound(_node_ids.begin(), _node_ids.end(), node_id);
+    return (it != _node_ids.end() && *it == node_id) ? it - _node_ids.begin() : invalid_index;
+  }
+
+  /// The number of rows
+  std::size_t nRows() const { return _offsets.empty() ? 0 : _offsets.size() - 1; }
+
+  /// The elements of a row
+  ElemRange rowElems(std::size_t row) const
+  {
+    ElemRange range;
+    range.first = _elems.data() + _offsets[row];
+    range.last = _elems.data() + _offsets[row + 1];
+    return range;
+  }
+
+  /// The elements connected to a node; empty for nodes that are not in any element
+  ElemRange elems(dof_id_type node_id) const
+  {
+    std::size_t row = localIndex(node_id);
+    if (row != invalid_index)
+      return rowElems(row);
+
+    ElemRange range;
+    range.first = range.last = NULL;
+    if (!_extra_elems.empty())
+    {
+      std::map<dof_id_type, std::vector<dof_id_type> >::const_iterator it = _extra_elems.find(node_id);
+      if (it != _extra_elems.end())
+      {
+        range.first = it->second.data();
+        range.last = it->second.data() + it->second.size();
+      }
+    }
+    return range;
+  }
+
+  /// The elements of a node as it->second, or end() if the node is not in any element
+  const_iterator find(dof_id_type node_id) const
+  {
+    ElemRange range = elems(node_id);
+    return range.empty() ? end() : const_iterator(node_id, range);
+  }
+
+  const_iterator end() const
+  {
+    ElemRange range;
+    range.first = range.last = NULL;
+    return const_iterator(std::numeric_limits<dof_id_type>::max(), range);
+  }
+
+protected:
+  /// The position in _elems of the first element of each row, followed by the size of _elems
+  std::vector<std::size_t> _offsets;
+
+  /// The element ids, grouped by row
+  std::vector<dof_id_type> _elems;
+
+  /// The sorted node id of each row, empty if the rows are indexed by node id
+  std::vector<dof_id_type> _node_ids;
+
+  /// The elements of the nodes added by addElem()
+  std::map<dof_id_type, std::vector<dof_id_type> > _extra_elems;
+};
+
+#endif // NODEELEMADJACENCY_H
@@ -33,6 +33,9 @@ InputParameters validParams<PatternedMesh>();
  * no new nodes are added in order to generate a conforming grid, and
  * non-conforming grids (with nodes in the middle of edges) are not
  * allowed.
+ *
+ * On a DistributedMesh every processor builds only its part of the pattern,
+ * see TileAssembly.
  */
 class PatternedMesh : public MooseMesh
 {
@@ -55,9 +58,6 @@ protected:
   // Holds the pointers to the meshes
   std::vector<ReplicatedMesh *> _meshes;
 
-  // Holds a mesh for each row, these will be stitched together in the end
-  std::vector<ReplicatedMesh *> _row_meshes;
-
   const Real _x_width;
   const Real _y_width;
   const Real _z_width;
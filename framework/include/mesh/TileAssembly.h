@@ -0,0 +1,158 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef TILEASSEMBLY_H
+#define TILEASSEMBLY_H
+
+#include "MooseTypes.h"
+
+// libMesh includes
+#include "libmesh/mesh_base.h"
+#include "libmesh/parallel_object.h"
+
+// C++ includes
+#include <array>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Builds a mesh from translated copies ("cells") of one or more tile meshes
+ * arranged on a grid, the way repeated stitch_meshes() calls would, but
+ * without building the whole mesh on every processor.
+ *
+ * Every cell is a copy of a tile at an integer grid position, and the tiles
+ * are stitched to the neighboring cells through a pair of boundaries in each
+ * grid direction.  The nodes on those boundaries are matched through a hash of
+ * their quantized coordinates, and a node shared by several cells belongs to the
+ * one added first.  The ids follow from the order the cells were added in: the
+ * elements and the nodes of a cell are numbered after those of the cells added
+ * before it, in the order of the tile, which is the numbering stitch_meshes()
+ * gives.
+ *
+ * A ReplicatedMesh gets all cells.  On a DistributedMesh the cells are split
+ * into contiguous ranges of about the same number of elements, and each
+ * processor builds only its own cells and the cells around them.
+ */
+class TileAssembly : public ParallelObject
+{
+public:
+  /**
+   * @param comm_in The communicator the mesh is built on
+   * @param tiles The meshes the cells are copies of
+   */
+  TileAssembly(const Parallel::Communicator & comm_in, const std::vector<const MeshBase *> & tiles);
+
+  /**
+   * Stitch the cells in grid direction dir: the boundary upper of a cell is joined to the boundary
+   * lower of the cell after it in that direction.  The ids of the stitched boundaries are removed.
+   */
+  void stitch(unsigned int dir, BoundaryID lower, BoundaryID upper);
+
+  /**
+   * Add a copy of a tile.  Cells are numbered in the order they are added.
+   * @param tile The index of the tile
+   * @param position The position of the cell in the grid
+   * @param offset The translation of the tile
+   */
+  void addCell(unsigned int tile, const std::array<int, 3> & position, const Point & offset);
+
+  /// Build the cells into the (empty) mesh
+  void build(MeshBase & mesh);
+
+  /// The id of a boundary given by number or by a side set name of one of the tiles
+  BoundaryID getBoundaryID(const BoundaryName & name) const;
+
+protected:
+  /// A copy of a tile
+  struct Cell
+  {
+    unsigned int tile;
+    std::array<int, 3> position;
+    Point offset;
+  };
+
+  /// Quantized coordinates
+  typedef std::array<long int, 3> Key;
+
+  struct KeyHash
+  {
+    std::size_t operator()(const Key & key) const
+    {
+      return (static_cast<std::size_t>(key[0]) * 73856093) ^ (static_cast<std::size_t>(key[1]) * 19349663) ^
+             (static_cast<std::size_t>(key[2]) * 83492791);
+    }
+  };
+
+  /// Index the nodes of the tiles that are on a stitched boundary by their quantized coordinates
+  void hashTiles();
+
+  /// The quantized coordinates of a point
+  Key quantize(const Point & p) const;
+
+  /// The index of the cell at a grid position, or invalid_id if there is none
+  dof_id_type cellAt(const std::array<int, 3> & position) const;
+
+  /**
+   * The cell a node of a cell belongs to, and the index of the node in the tile of that cell
+   * @param cell The cell
+   * @param node The index of the node in the tile of cell
+   */
+  std::pair<dof_id_type, dof_id_type> nodeOwner(dof_id_type cell, dof_id_type node) const;
+
+  /// The global ids of the nodes of a cell, invalid_id for the nodes that belong to another cell
+  const std::vector<dof_id_type> & ownedNodeIds(dof_id_type cell);
+
+  /// The global id of a node of a cell
+  dof_id_type globalNodeId(dof_id_type cell, dof_id_type node);
+
+  /// The processor that owns a cell on a DistributedMesh, and that counts its nodes on a ReplicatedMesh
+  processor_id_type cellProcessor(dof_id_type cell) const;
+
+  /// The tile meshes
+  std::vector<const MeshBase *> _tiles;
+
+  /// The nodes and elements of each tile in increasing id
+  std::vector<std::vector<const Node *> > _tile_nodes;
+  std::vector<std::vector<const Elem *> > _tile_elems;
+
+  /// The index of each node of each tile that is on a stitched boundary, by quantized coordinates
+  std::vector<std::unordered_map<Key, dof_id_type, KeyHash> > _boundary_nodes;
+
+  /// Whether each node of each tile is on a stitched boundary
+  std::vector<std::vector<bool> > _on_boundary;
+
+  /// The stitched boundaries in each direction
+  std::array<BoundaryID, 3> _lower, _upper;
+
+  /// The size of a quantization step
+  Real _quantum;
+
+  /// The cells in the order they were added
+  std::vector<Cell> _cells;
+
+  /// The index of the cell at each grid position
+  std::map<std::array<int, 3>, dof_id_type> _cell_at;
+
+  /// The first element and node ids of each cell
+  std::vector<dof_id_type> _elem_offsets, _node_offsets;
+
+  /// The global ids of the nodes of the cells needed so far, see ownedNodeIds()
+  std::unordered_map<dof_id_type, std::vector<dof_id_type> > _owned_node_ids;
+
+  /// An invalid cell or node index
+  static const dof_id_type invalid_id;
+};
+
+#endif // TILEASSEMBLY_H
@@ -24,6 +24,7 @@ class FEProblem;
 class Executioner;
 class MooseApp;
 class Backup;
+struct MeshTemplate;
 
 // libMesh forward declarations
 namespace libMesh
@@ -102,6 +103,11 @@ public:
    */
   virtual void restore();
 
+  /**
+   * The memory held by the Backups of the local Apps, in bytes
+   */
+  std::size_t backupMemoryUsage();
+
   /**
    * Whether or not this MultiApp should be restored at the beginning of
    * each Picard iteration.
@@ -260,6 +266,18 @@ protected:
    */
   void buildComm();
 
+  /**
+   * Split the Apps into contiguous ranges of about the same total cost, one range per
+   * processor, using _app_costs. Used by buildComm() when there are more Apps than processors.
+   */
+  void partitionAppsByCost();
+
+  /**
+   * Write the accumulated solve time of each App to the file written for 'output_app_costs',
+   * which can be read by 'app_costs_file' to balance the next run.
+   */
+  void writeAppCosts();
+
   /**
    * Map a global App number to the local number.
    * Note: This will error if given a global number that doesn't map to a local number.
@@ -352,6 +370,27 @@ protected:
 
   /// Backups for each local App
   SubAppBackups & _backups;
+
+  /// The estimated cost of each App, used to distribute the Apps; empty for an even distribution
+  std::vector<Real> _app_costs;
+
+  /// Whether or not to write the solve time of each App
+  bool _output_app_costs;
+
+  /// The accumulated wall time spent solving each local App
+  std::vector<Real> _app_solve_times;
+
+  /// Whether the Backups of the Apps copy the system vectors instead of serializing them
+  bool _in_memory_backup;
+
+  /// Whether the Apps created from the same input file share their mesh
+  bool _share_mesh;
+
+  /// Whether the Apps created from the same input file also share their projected initial condition
+  bool _share_initial_condition;
+
+  /// The mesh shared by the Apps of each input file
+  std::map<std::string, MooseSharedPointer<MeshTemplate> > _mesh_templates;
 };
 
 template<>
@@ -62,6 +62,19 @@ private:
    */
   void setupApp(unsigned int i, Real time = 0.0);
 
+  /**
+   * Adds a sub-cycle or catch up step to the statistics.
+   * @param dt The step
+   * @param converged Whether the solve converged
+   */
+  void recordSubStep(Real dt, bool converged);
+
+  /// Offers a step that converged after a failure to the other apps (if share_sub_cycle_dt is set)
+  void shareDT(Real dt);
+
+  /// Shares the steps and prints the statistics of all the apps, called by every processor after a solve
+  void reduceSubCycleData();
+
   std::vector<Transient *> _transient_executioners;
 
   bool _sub_cycling;
@@ -95,6 +108,26 @@ private:
 
   /// Flag for toggling console output on sub cycles
   bool _print_sub_cycles;
+
+  /// Whether the apps start with the step that converged after a failure of another app
+  bool _share_sub_cycle_dt;
+
+  /// Whether the sub-cycle statistics are printed after each solve
+  bool _print_sub_cycle_statistics;
+
+  /// The smallest step that converged after a failure, in the local apps of this solve or in any app of the previous one
+  Real _shared_dt;
+
+  /// The smallest step that converged after a failure in the local apps of this solve
+  Real _local_shared_dt;
+
+  ///@{
+  /// Sub-cycle statistics of the local apps for the current solve
+  unsigned int _n_sub_steps;
+  unsigned int _n_failed_sub_steps;
+  Real _min_sub_dt;
+  Real _max_sub_dt;
+  ///@}
 };
 
 /**
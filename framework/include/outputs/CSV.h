@@ -94,6 +94,15 @@ private:
 
   /// Flag for writting vector postprocessor data
   bool _write_vector_table;
+
+  /// Only write the new rows of the tables
+  bool _incremental;
+
+  /// The number of rows kept in memory with incremental output
+  unsigned int _incremental_window;
+
+  /// Flag for writing the per-object performance log
+  bool _object_perf_log;
 };
 
 #endif /* CSV_H */
@@ -42,6 +42,12 @@ struct CheckpointFileNames
 
   /// Filename for restartable data filename
   std::string restart;
+
+  /// Filename for the manifest of a per-rank checkpoint, empty for the other formats
+  std::string manifest;
+
+  /// Restartable data filename of the full checkpoint a delta checkpoint depends on, empty for full checkpoints
+  std::string full_restart;
 };
 
 /**
@@ -57,6 +63,11 @@ public:
    */
   Checkpoint(const InputParameters & parameters);
 
+  /**
+   * Class destructor, completes the per-rank checkpoint that is being written
+   */
+  virtual ~Checkpoint();
+
   /**
    * Outputs a checkpoint file.
    * Each call to this function creates various files associated with
@@ -78,6 +89,29 @@ protected:
 
   void updateCheckpointFiles(CheckpointFileNames file_struct);
 
+  /**
+   * Write the mesh and queue the per-rank data files for 'format = per_rank'
+   * @param current_file The base name of the checkpoint files
+   */
+  void outputPerRank(const std::string & current_file);
+
+  /**
+   * Wait for the per-rank data files that are being written, then write the manifest
+   * which makes the checkpoint available for recovery.
+   */
+  void commitPerRankCheckpoint();
+
+  /**
+   * Write the restartable data in full, or only the values that changed since the last full checkpoint
+   * @param file_struct The files of the current checkpoint, full_restart is set for a delta checkpoint
+   */
+  void outputRestartableData(CheckpointFileNames & file_struct);
+
+  /**
+   * Remove the restartable data files (.rd) with the supplied base name
+   */
+  void removeRestartableDataFiles(const std::string & restart);
+
 private:
 
   /// Max no. of output files to store
@@ -109,6 +143,36 @@ private:
 
   /// Vector of checkpoint filename structures
   std::deque<CheckpointFileNames> _file_names;
+
+  /// True if each processor writes its solution and restartable data to its own file, in the background
+  bool _per_rank;
+
+  /// True if the per-rank files are compressed
+  bool _compress;
+
+  /// True if a per-rank checkpoint has been queued and not committed
+  bool _has_pending;
+
+  /// The files of the per-rank checkpoint that has been queued
+  CheckpointFileNames _pending;
+
+  /// The restartable data is written in full every _full_interval checkpoints
+  const unsigned int _full_interval;
+
+  /// The number of delta checkpoints since the last full one
+  unsigned int _n_delta;
+
+  /// The hashes of the restartable data at the last full checkpoint
+  RestartableDataHashes _full_hashes;
+
+  /// The restartable data filename of the last full checkpoint
+  std::string _full_restart;
+
+  /// Restartable data of removed full checkpoints that retained delta checkpoints depend on
+  std::vector<std::string> _retained_full_restart;
+
+  /// True if the solution is written to a single file instead of one per processor
+  const bool _serial_solution;
 };
 
 #endif //CHECKPOINT_H
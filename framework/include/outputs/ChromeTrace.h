@@ -0,0 +1,56 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef CHROMETRACE_H
+#define CHROMETRACE_H
+
+// MOOSE includes
+#include "BasicOutput.h"
+#include "FileOutput.h"
+
+// Forward declarations
+class ChromeTrace;
+
+template<>
+InputParameters validParams<ChromeTrace>();
+
+/**
+ * Writes the timeline recorded by Moose::trace_log as a Chrome trace event file
+ * (load it with chrome://tracing or https://ui.perfetto.dev).
+ *
+ * Every rank records its own events; they are gathered to rank 0 and written to a
+ * single file, with "pid" set to the MPI rank and "tid" to the thread, so that
+ * solves, transfers, MultiApp executions and output writes of all ranks appear on
+ * one timeline.
+ */
+class ChromeTrace : public BasicOutput<FileOutput>
+{
+public:
+  ChromeTrace(const InputParameters & parameters);
+
+  /**
+   * The filename for the output file
+   * @return A string of output file including the extension
+   */
+  virtual std::string filename() override;
+
+protected:
+  /**
+   * Gather the events from all ranks and write the file.
+   * The whole file is re-written with all events recorded so far.
+   */
+  virtual void output(const ExecFlagType & type) override;
+};
+
+#endif /* CHROMETRACE_H */
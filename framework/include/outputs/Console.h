@@ -18,6 +18,9 @@
 // MOOSE includes
 #include "TableOutput.h"
 
+// C++ includes
+#include <chrono>
+
 // Forward declarations
 class Console;
 
@@ -153,6 +156,17 @@ protected:
    */
   void writeVariableNorms();
 
+  /**
+   * Write the buffered screen output (see 'screen_flush_interval' and 'screen_flush_wall_time')
+   */
+  void flushScreenBuffer();
+
+  /**
+   * Print the iteration counts and final residual of the last solve, used in place
+   * of the per-iteration residuals when 'summary_only' is true
+   */
+  void writeSolveSummary();
+
   /// The max number of table rows
   unsigned int _max_rows;
 
@@ -168,6 +182,27 @@ protected:
   /// Flag for controlling outputting console information to screen
   bool _write_screen;
 
+  /// The number of time steps between writes of the buffered screen output
+  unsigned int _flush_interval;
+
+  /// The wall time (seconds) between writes of the buffered screen output
+  Real _flush_wall_time;
+
+  /// True if screen output is buffered rather than written as it is produced
+  bool _buffer_screen;
+
+  /// Flag for replacing the residual output with a summary of each solve
+  bool _summary_only;
+
+  /// Stream for storing screen output until the next flush
+  std::ostringstream _screen_buffer;
+
+  /// Number of time steps since the screen buffer was last written
+  unsigned int _n_buffered_steps;
+
+  /// The time the screen buffer was last written
+  std::chrono::steady_clock::time_point _last_flush;
+
   /// Flag for writing detailed time step information
   bool _verbose;
 
@@ -197,6 +232,9 @@ protected:
   /// State for the performance log header information
   bool _perf_header;
 
+  /// State for the per-object performance log
+  bool _object_perf_log;
+
   /// Flag for writing all variable norms
   bool _all_variable_norms;
 
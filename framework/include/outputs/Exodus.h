@@ -43,6 +43,11 @@ public:
    */
   Exodus(const InputParameters & parameters);
 
+  /**
+   * Class destructor, completes any asynchronous writes
+   */
+  virtual ~Exodus();
+
   /**
    * Overload the OutputBase::output method, this is required for ExodusII
    * output due to the method utilized for outputing single/global parameters
@@ -79,6 +84,12 @@ public:
    */
   virtual void sequence(bool state);
 
+  /**
+   * Block until the asynchronous writes queued by this object have been written to the file.
+   * This does nothing if 'asynchronous = false'.
+   */
+  void flush();
+
 protected:
 
   /**
@@ -143,6 +154,12 @@ private:
    */
   void outputEmptyTimestep();
 
+  /**
+   * Queue the data collected by the output methods to be written by the writer thread
+   * @see _asynchronous
+   */
+  void outputTimestepAsynchronous();
+
   /// Count of outputs per exodus file
   unsigned int & _exodus_num;
 
@@ -160,6 +177,28 @@ private:
 
   /// Flag for overwriting timesteps
   bool _overwrite;
+
+  /**
+   * Flag for writing the data on a background thread. The first timestep of each file, which
+   * defines the mesh and the variables, is always written directly; the
+   * following ones are copied and then written while the simulation continues.
+   */
+  bool _asynchronous;
+
+  /// True while the current output is being written asynchronously
+  bool _output_asynchronous;
+
+  /// The nodal solution of all variables (ordered by node then variable), collected for the writer thread
+  std::vector<Number> _async_nodal_solution;
+
+  /// The variable names of the entries in _async_nodal_solution
+  std::vector<std::string> _async_nodal_names;
+
+  /// The material properties written as element averages (see ComputeElemMaterialAveragesThread)
+  std::vector<std::string> _material_properties;
+
+  /// The names of the components of _material_properties in the file
+  std::vector<std::string> _material_output_names;
 };
 
 #endif /* EXODUS_H */
@@ -0,0 +1,62 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef MATERIALPROPERTYMEMORYDEBUGOUTPUT_H
+#define MATERIALPROPERTYMEMORYDEBUGOUTPUT_H
+
+// MOOSE includes
+#include "BasicOutput.h"
+#include "Output.h"
+
+// Forward declerations
+class MaterialPropertyMemoryDebugOutput;
+class MaterialPropertyStorage;
+
+template<>
+InputParameters validParams<MaterialPropertyMemoryDebugOutput>();
+
+/**
+ * Prints the memory used by each stateful material property (bytes per qp, number of
+ * stored states and total size over all processors), to find the properties that
+ * dominate the memory of a run.
+ *
+ * This class may be used from inside the [Outputs] block or via the [Debug] block (preferred)
+ */
+class MaterialPropertyMemoryDebugOutput : public BasicOutput<Output>
+{
+public:
+
+  /**
+   * Class constructor
+   * @param parameters Object input parameters
+   */
+  MaterialPropertyMemoryDebugOutput(const InputParameters & parameters);
+
+protected:
+
+  /**
+   * Perform the debugging output
+   */
+  virtual void output(const ExecFlagType & type) override;
+
+  /**
+   * Add the table for one of the property storages to the output stream
+   * @param output The output stream to populate
+   * @param storage The volume or boundary stateful property storage
+   * @return The total size of the properties in the storage, in bytes
+   */
+  Real printStorage(std::ostream & output, const MaterialPropertyStorage & storage) const;
+};
+
+#endif // MATERIALPROPERTYMEMORYDEBUGOUTPUT_H
@@ -26,7 +26,6 @@ class MooseMesh;
 namespace libMesh
 {
 template <typename T> class NumericVector;
-class MeshFunction;
 }
 
 
@@ -116,22 +115,35 @@ private:
   void cloneMesh();
 
   /**
-   * A vector of pointers to the mesh functions
-   * This is only populated when the oversample() function is called, it must
-   * be cleaned up by the destructor.
+   * Locates each local oversampled node in the source mesh and stores the data needed to
+   * evaluate the source variables there, so that updateOversample() does not repeat the point
+   * location until the source mesh changes.
    */
-  std::vector<std::vector<MeshFunction *> > _mesh_functions;
+  void cacheOversampleNodes();
+
+  /// The source dofs and the shape function values that give an oversampled dof value
+  struct OversampleValue
+  {
+    std::vector<dof_id_type> dofs;
+    std::vector<Real> phi;
+  };
+
+  /// True for each system that contains variables
+  std::vector<bool> _has_variables;
+
+  /// The oversampled dofs set by updateOversample(), per system
+  std::vector<std::vector<numeric_index_type> > _oversample_dofs;
+
+  /// The interpolation data for each of the _oversample_dofs, per system
+  std::vector<std::vector<OversampleValue> > _oversample_values;
 
   /// When oversampling, the output is shift by this amount
   Point _position;
 
-  /// A flag indicating that the mesh has changed and the oversampled mesh needs to be re-initialized
+  /// A flag indicating that the source mesh has changed and the cached node locations must be rebuilt
   bool _oversample_mesh_changed;
 
-  /// Oversample solution vector
-  /* Each of the MeshFunctions keeps a reference to this vector, the vector is updated for the current system
-   * and variable before the MeshFunction is applied. This allows for the same MeshFunction object to be
-   * re-used, unless the mesh has changed due to adaptivity */
+  /// Serialized copy of the solution of the system being oversampled
   std::unique_ptr<NumericVector<Number> > _serialized_solution;
 };
 
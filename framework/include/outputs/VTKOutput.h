@@ -19,6 +19,9 @@
 #include "BasicOutput.h"
 #include "OversampleOutput.h"
 
+// libMesh includes
+#include "libmesh/parallel.h"
+
 // Forward declerations
 class VTKOutput;
 
@@ -52,11 +55,24 @@ protected:
    */
   virtual std::string filename() override;
 
+  /**
+   * Write the pieces aggregated on the I/O ranks (see 'n_files') and the .pvtu file
+   * that references them.  Only the LAGRANGE (point data) and CONSTANT MONOMIAL (cell
+   * data) variables are written, the cells are made of the vertices of the elements.
+   */
+  void outputAggregated();
+
 private:
 
   /// Flag for using binary compression
   bool _binary;
 
+  /// The number of files the processors write to, 0 for one file per processor
+  const unsigned int _n_files;
+
+  /// The processors that write to the same file, the first writes the file
+  Parallel::Communicator _aggregation_comm;
+
 };
 
 #endif //VTKOUTPUT_H
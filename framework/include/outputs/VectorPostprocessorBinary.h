@@ -0,0 +1,84 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef VECTORPOSTPROCESSORBINARY_H
+#define VECTORPOSTPROCESSORBINARY_H
+
+// MOOSE includes
+#include "AdvancedOutput.h"
+#include "FileOutput.h"
+
+// C++ includes
+#include <cstdint>
+#include <fstream>
+
+// Forward declarations
+class VectorPostprocessorBinary;
+
+template<>
+InputParameters validParams<VectorPostprocessorBinary>();
+
+/**
+ * Writes the VectorPostprocessor vectors to binary files, one file per VectorPostprocessor
+ * (<file_base>_<name>.vpp) with a record appended at each output, so that large samplers
+ * can be output at every step without formatting any text.
+ *
+ * All values are in the native byte order and every field is 8 bytes, so that the columns
+ * can be mapped directly (see python/postprocessing/read_vpp_binary.py):
+ *  - header: "MOOSEVPP", the format version (uint64), the number of columns (uint64) and,
+ *    for each column, the length of its name (uint64) and the name padded with '\0' to a
+ *    multiple of 8 bytes
+ *  - record: the time (float64), the time step (int64), the length of each column (uint64)
+ *    and then the values of each column (float64), one column after the other
+ */
+class VectorPostprocessorBinary : public AdvancedOutput<FileOutput>
+{
+public:
+  VectorPostprocessorBinary(const InputParameters & parameters);
+
+  /**
+   * The name of the file for a VectorPostprocessor
+   */
+  std::string filename(const std::string & vpp_name);
+
+  /**
+   * The file name pattern of the output files, used by the base class
+   */
+  virtual std::string filename() override;
+
+protected:
+  /**
+   * Append a record to the file of each VectorPostprocessor
+   */
+  virtual void outputVectorPostprocessors() override;
+
+  /**
+   * Open the file for a VectorPostprocessor at the position of the next record.  The header is
+   * written when the file is first opened, or checked on restart, in which case the records from
+   * the time steps that are written again are removed.  An earlier record for the current time
+   * step (output more than once) is replaced.
+   */
+  void openFile(const std::string & file_name, const std::vector<std::string> & columns, std::fstream & out);
+
+  /// Truncate the file at the supplied position and open it for writing there
+  void appendAt(const std::string & file_name, std::streamoff position, std::fstream & out);
+
+  /// The version of the file format
+  static const uint64_t _version;
+
+  /// The time step and position of the last record written to each file by this run
+  std::map<std::string, std::pair<int, std::streamoff> > _last_record;
+};
+
+#endif /* VECTORPOSTPROCESSORBINARY_H */
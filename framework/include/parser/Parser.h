@@ -113,6 +113,12 @@ public:
   void checkOverriddenParams(bool error_on_warn) const;
 
 protected:
+  /**
+   * Returns the contents of the input file.  The file is read by processor 0 of the application
+   * (at most once per process) and its contents are broadcast to the other processors.
+   */
+  std::string readInputFile(const std::string & input_filename);
+
   /// Appends sections from the CLI Reorders section names so that Debugging options can be enabled before parsing begins
   void appendAndReorderSectionNames(std::vector<std::string> & section_names);
 
@@ -0,0 +1,85 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef COSTWEIGHTEDPARTITIONER_H
+#define COSTWEIGHTEDPARTITIONER_H
+
+#include "MoosePartitioner.h"
+
+// libMesh includes
+#include "libmesh/error_vector.h"
+
+// C++ includes
+#include <unordered_map>
+
+class CostWeightedPartitioner;
+
+template<>
+InputParameters validParams<CostWeightedPartitioner>();
+
+/**
+ * Partitions the mesh with METIS, weighting each element by the time its residual
+ * took to compute during the previous time steps, as recorded in the ElementCostLog
+ * of the problem.  The first partitioning, before anything is measured, is the plain
+ * METIS partitioning.
+ *
+ * FEProblem::rebalanceMesh() checks the measured load imbalance after each time step
+ * and repartitions the mesh when it exceeds the imbalance_threshold.
+ */
+class CostWeightedPartitioner : public MoosePartitioner
+{
+public:
+  CostWeightedPartitioner(const InputParameters & params);
+
+  virtual std::unique_ptr<Partitioner> clone() const override;
+  virtual void partition(MeshBase & mesh, const unsigned int n) override;
+  virtual void partition(MeshBase & mesh) override;
+
+  /**
+   * Count a time step, and return true if the imbalance should be checked after it.
+   */
+  bool checkDue();
+
+  /**
+   * Compute the load imbalance from the costs recorded on each processor and, if it is above
+   * the threshold, set the weights used by the next partitioning.  Must be called on all processors.
+   * @param mesh The mesh that will be partitioned
+   * @param costs The recorded cost of the local elements, see ElementCostLog::costs()
+   * @return true if the mesh should be repartitioned
+   */
+  bool updateWeights(const MeshBase & mesh, const std::unordered_map<dof_id_type, Real> & costs);
+
+  /// The ratio of the largest processor cost to the mean, as computed by the last call to updateWeights()
+  Real imbalance() const { return _imbalance; }
+
+protected:
+  virtual void _do_partition(MeshBase & mesh, const unsigned int n) override;
+
+  /// The imbalance above which the mesh is repartitioned
+  const Real _imbalance_threshold;
+
+  /// The number of time steps between the checks of the imbalance
+  const unsigned int _check_interval;
+
+  /// The time steps counted by checkDue() since the last check
+  unsigned int _steps_since_check;
+
+  /// The imbalance computed by the last call to updateWeights()
+  Real _imbalance;
+
+  /// The METIS weight of each element, indexed by element id; empty until the costs are measured
+  ErrorVector _weights;
+};
+
+#endif /* COSTWEIGHTEDPARTITIONER_H */
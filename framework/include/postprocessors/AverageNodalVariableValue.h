@@ -32,6 +32,7 @@ public:
   virtual void execute() override;
 
   virtual Real getValue() override;
+  virtual bool deferReduction() const override { return true; }
 
   virtual void threadJoin(const UserObject & y) override;
 
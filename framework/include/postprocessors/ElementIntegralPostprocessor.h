@@ -38,6 +38,7 @@ public:
   virtual void execute() override;
   virtual void threadJoin(const UserObject & y) override;
   virtual Real getValue() override;
+  virtual bool deferReduction() const override { return true; }
 
 protected:
   virtual Real computeQpIntegral() = 0;
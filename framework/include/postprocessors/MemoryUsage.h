@@ -0,0 +1,98 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef MEMORYUSAGE_H
+#define MEMORYUSAGE_H
+
+#include "GeneralPostprocessor.h"
+
+//Forward Declarations
+class MemoryUsage;
+class MaterialPropertyStorage;
+
+template<>
+InputParameters validParams<MemoryUsage>();
+
+/**
+ * Reports the memory used by the process, or an estimate of the memory held by
+ * one of the large framework data structures, so that the growth of each can be
+ * followed over the time steps.  The values are computed per processor and
+ * reduced with the selected "reduction" (the largest processor by default).
+ */
+class MemoryUsage : public GeneralPostprocessor
+{
+public:
+  MemoryUsage(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void finalize() override;
+  virtual Real getValue() override;
+
+  /// The data structures that can be reported
+  enum DataType
+  {
+    PHYSICAL_MEMORY,
+    MATERIAL_PROPERTIES,
+    MESH,
+    GEOMETRIC_SEARCH,
+    RESTARTABLE_DATA,
+    MULTIAPP_BACKUPS
+  };
+
+  /// How the values of the processors are combined
+  enum ReductionType
+  {
+    MAX_PROCESS,
+    MIN_PROCESS,
+    TOTAL,
+    AVERAGE
+  };
+
+protected:
+  /**
+   * The stateful material property memory of a storage, for the selected property and states
+   * @param found Set to true if the selected property is in the storage
+   */
+  std::size_t materialPropertyMemory(const MaterialPropertyStorage & storage, bool & found) const;
+
+  /// The size of the serialized restartable data, without the MultiApp backups
+  std::size_t restartableDataMemory() const;
+
+  /// The data structure that is reported
+  DataType _data;
+
+  /// How the values of the processors are combined
+  ReductionType _reduction;
+
+  /// Report the peak instead of the current value
+  bool _peak;
+
+  /// Divisor converting bytes to the reported units
+  Real _unit_size;
+
+  /// The stateful material property to report, all of them if empty
+  std::string _property;
+
+  /// The states of the material properties to report: 0 for all, 1 for current, 2 for old, 3 for older
+  unsigned int _state;
+
+  /// The value on this processor, then the reduced value
+  Real _value;
+
+  /// The largest value seen on this processor
+  Real & _high_water_mark;
+};
+
+#endif // MEMORYUSAGE_H
@@ -35,6 +35,7 @@ public:
   virtual void initialize() override;
   virtual void execute() override;
   virtual Real getValue() override;
+  virtual bool deferReduction() const override { return true; }
   virtual void threadJoin(const UserObject & y) override;
 
 protected:
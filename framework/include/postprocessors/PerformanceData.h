@@ -16,6 +16,7 @@
 #define PERFORMANCEDATA_H
 
 #include "GeneralPostprocessor.h"
+#include "ObjectPerfLog.h"
 
 //Forward Declarations
 class PerformanceData;
@@ -52,6 +53,12 @@ protected:
 
   std::string _category;
   std::string _event;
+
+  /// True if _category is one of the ObjectPerfLog categories
+  bool _object_timing;
+
+  /// The ObjectPerfLog category, valid if _object_timing is true
+  ObjectPerfLog::Category _object_category;
 };
 
 #endif // PERFORMANCEDATA_H
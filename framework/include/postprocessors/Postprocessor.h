@@ -42,6 +42,14 @@ public:
    */
   virtual PostprocessorValue getValue() = 0;
 
+  /**
+   * Return true to let FEProblem pack the reductions done by this Postprocessor with those of the
+   * others (see DeferredReduction).  getValue() is then called twice, the first result is
+   * discarded, so it may only reduce member variables and must have the same result when its
+   * reductions are skipped the second time; it must not modify the reduced values after the gathers.
+   */
+  virtual bool deferReduction() const { return false; }
+
   /**
    * Returns the name of the Postprocessor.
    */
@@ -0,0 +1,125 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef GEOMETRICMULTIGRIDPRECONDITIONER_H
+#define GEOMETRICMULTIGRIDPRECONDITIONER_H
+
+#include "libmesh/petsc_macro.h"
+
+#if defined(LIBMESH_HAVE_PETSC) && !PETSC_VERSION_LESS_THAN(3,5,0)
+
+// MOOSE includes
+#include "MoosePreconditioner.h"
+
+// libMesh includes
+#include "libmesh/preconditioner.h"
+
+// PETSc includes
+#include <petscksp.h>
+
+// C++ includes
+#include <map>
+#include <vector>
+
+// Forward declarations
+class NonlinearSystem;
+class GeometricMultigridPreconditioner;
+
+template<>
+InputParameters validParams<GeometricMultigridPreconditioner>();
+
+/**
+ * Geometric multigrid on the refinement hierarchy of the mesh (Mesh/uniform_refine, or the
+ * levels below the coarsest active elements with adaptivity).
+ *
+ * The DOFs of a coarse level are the nodes of the elements of that refinement level, and the
+ * interpolation to the next level evaluates the LAGRANGE shape functions of the parent elements
+ * at the nodes of their children.  The coarse operators are the Galerkin products P^T A P of the
+ * assembled Jacobian, which are the coarse discretizations of the kernels for nested LAGRANGE
+ * spaces, so no coarse problem is assembled.  The V-cycle is PETSc's PCMG, whose smoothers and
+ * coarse solver are set with the "gmg_" prefix (e.g. -gmg_mg_levels_ksp_type).
+ */
+class GeometricMultigridPreconditioner :
+    public MoosePreconditioner,
+    public Preconditioner<Number>
+{
+public:
+  GeometricMultigridPreconditioner(const InputParameters & params);
+  virtual ~GeometricMultigridPreconditioner();
+
+  /**
+   * Computes the preconditioned vector "y" based on input "x" with one V-cycle.
+   */
+  virtual void apply(const NumericVector<Number> & x, NumericVector<Number> & y) override;
+
+  /**
+   * Release all memory and clear data structures.
+   */
+  virtual void clear() override;
+
+  /**
+   * Build the hierarchy of interpolations and the multigrid solver.
+   */
+  virtual void init() override;
+
+  /**
+   * Set the assembled Jacobian as the operator of the finest level, the hierarchy is rebuilt
+   * first if the mesh changed.
+   */
+  virtual void setup() override;
+
+protected:
+  /**
+   * Number the DOFs of coarse level i: the nodes of the elements of that refinement level, by
+   * processor and then by node id like every processor would.
+   */
+  void numberLevel(unsigned int i);
+
+  /**
+   * Build the interpolation from coarse level i to level i + 1, or to the nonlinear system for
+   * the last coarse level.
+   */
+  Mat buildInterpolation(unsigned int i);
+
+  /// The nonlinear system this preconditioner is associated with (convenience reference)
+  NonlinearSystem & _nl;
+
+  /// The number of coarse levels requested, 0 for as many as the mesh has
+  const unsigned int _max_coarse_levels;
+
+  /// The refinement level of the first (coarsest) level
+  unsigned int _first_level;
+
+  /// The global index of each (node id, variable) DOF, per coarse level
+  std::vector<std::map<std::pair<dof_id_type, unsigned int>, PetscInt> > _coarse_dofs;
+
+  /// The number of DOFs of this processor, per coarse level
+  std::vector<PetscInt> _n_local_coarse_dofs;
+
+  /// The interpolation to the next level, per coarse level
+  std::vector<Mat> _interpolations;
+
+  /// The multigrid solver
+  KSP _ksp;
+
+  ///@{
+  /// The size of the mesh and of the nonlinear system the hierarchy was built for
+  dof_id_type _hierarchy_n_dofs;
+  dof_id_type _hierarchy_n_elem;
+  ///@}
+};
+
+#endif // LIBMESH_HAVE_PETSC
+
+#endif // GEOMETRICMULTIGRIDPRECONDITIONER_H
@@ -76,6 +76,12 @@ public:
   virtual void setup();
 
 protected:
+  /**
+   * Find the DOFs of a variable of the nonlinear system and the matching DOFs of the
+   * variable of a preconditioning system, in the same order as MoosePreconditioner::copyVarValues()
+   */
+  void cacheVarDofs(unsigned int system_var);
+
   /// The nonlinear system this PBP is associated with (convenience reference)
   NonlinearSystem & _nl;
   /// List of linear system that build up the preconditioner
@@ -97,6 +103,27 @@ protected:
    * to keep looking this thing up through it's name.
    */
   std::vector<std::vector<SparseMatrix<Number> *> > _off_diag_mats;
+
+  /// True if no off diagonal blocks are computed, each block is then solved at most once in apply()
+  bool _block_diagonal;
+
+  /// The variable whose diagonal block and preconditioner are used for each variable, itself unless it is shared
+  std::vector<unsigned int> _block_source;
+
+  /// True for the variables whose diagonal block is assembled only once (the "constant_blocks" parameter)
+  std::vector<bool> _constant_block;
+
+  /// True once the diagonal block of a constant_blocks variable has been assembled
+  std::vector<bool> _constant_block_built;
+
+  /// The DOFs of each variable in the nonlinear system, built by setup()
+  std::vector<std::vector<dof_id_type> > _nl_dofs;
+
+  /// The DOFs of the preconditioning system of each variable, matching _nl_dofs
+  std::vector<std::vector<dof_id_type> > _system_dofs;
+
+  /// Values copied between the nonlinear and the preconditioning systems
+  std::vector<Number> _copy_values;
 };
 
 #endif //PHYSICSBASEDPRECONDITIONER_H
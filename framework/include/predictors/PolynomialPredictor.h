@@ -0,0 +1,85 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef POLYNOMIALPREDICTOR_H
+#define POLYNOMIALPREDICTOR_H
+
+// MOOSE includes
+#include "Predictor.h"
+
+// Forward declarations
+class PolynomialPredictor;
+
+template<>
+InputParameters validParams<PolynomialPredictor>();
+
+/**
+ * Predicts the solution by extrapolating the Lagrange polynomial through the
+ * last order+1 converged solutions to the new time.  Fewer solutions are used
+ * (lowering the order) at the beginning of the simulation.
+ *
+ * The prediction can be restricted to some variables, and skipped when the
+ * previous time step already needed few nonlinear iterations.  The average
+ * number of nonlinear iterations of the time steps with and without the
+ * predictor is reported, as an estimate of the iterations it saves.
+ */
+class PolynomialPredictor : public Predictor
+{
+public:
+  PolynomialPredictor(const InputParameters & parameters);
+
+  virtual int order() override { return _order; }
+  virtual void timestepSetup() override;
+  virtual bool shouldApply() override;
+  virtual void apply(NumericVector<Number> & sln) override;
+
+protected:
+  /// The k-th newest stored solution (k = 0 is the old solution)
+  NumericVector<Number> & history(unsigned int k);
+
+  /// The maximum order of the extrapolation
+  const unsigned int _order;
+
+  /// The predictor is skipped if the previous time step took fewer nonlinear iterations than this
+  const unsigned int _min_iterations;
+
+  /// The numbers of the variables that are predicted, empty for all of them
+  std::vector<unsigned int> _var_nums;
+
+  /// Ring buffer of the last converged solutions
+  std::vector<NumericVector<Number> *> _history;
+
+  /// The index in _history of the newest solution
+  unsigned int & _newest;
+
+  /// The times of the stored solutions, newest first
+  std::vector<Real> & _history_times;
+
+  /// The time step at the last timestepSetup()
+  int & _t_step_old;
+
+  /// Whether the predictor was applied in the last time step
+  bool & _applied;
+
+  /// Nonlinear iterations of the last completed time step
+  unsigned int & _last_iterations;
+
+  /// Numbers of completed time steps and their nonlinear iterations, with and without the predictor
+  unsigned int & _n_steps_predicted;
+  unsigned int & _n_its_predicted;
+  unsigned int & _n_steps_unpredicted;
+  unsigned int & _n_its_unpredicted;
+};
+
+#endif /* POLYNOMIALPREDICTOR_H */
@@ -15,13 +15,25 @@
 #ifndef BACKUP_H
 #define BACKUP_H
 
+// MOOSE includes
+#include "Moose.h"
+
+// libMesh includes
+#include "libmesh/numeric_vector.h"
+
 // C++ includes
 #include <sstream>
 #include <list>
+#include <memory>
 #include <vector>
 
 /**
  * Helper class to hold streams for Backup and Restore operations.
+ *
+ * The system data is either serialized in _system_data or, for a Backup
+ * created in memory, held as copies of the system vectors in
+ * _system_vectors, which avoids the stream round-trip when the Backup is
+ * only going to be restored by the same App.
  */
 class Backup
 {
@@ -30,8 +42,23 @@ public:
 
   ~Backup();
 
+  /**
+   * Move the copies of the system vectors into _system_data, in the format
+   * written by RestartableDataIO::serializeSystems().  Called before the
+   * Backup is written to a stream.
+   */
+  void serializeSystemVectors();
+
+  /**
+   * The memory held by the serialized data and the copies of the system vectors, in bytes
+   */
+  std::size_t memoryUsage();
+
   std::stringstream _system_data;
 
+  /// Copies of the solution and the other vectors of the systems (in memory Backups only)
+  std::vector<std::unique_ptr<NumericVector<Number> > > _system_vectors;
+
   std::vector<std::stringstream*> _restartable_data;
 };
 
@@ -134,6 +134,39 @@ template<typename T>
 inline void
 dataStore(std::ostream & stream, T & v, void * /*context*/);
 
+/**
+ * True for the types that are stored as their bytes, an array of them is stored and loaded
+ * as a single block (a single copy when the restart file is memory mapped).
+ */
+template<typename T>
+struct DataIOBlockCopyable
+{
+#ifdef LIBMESH_HAVE_CXX11_TYPE_TRAITS
+  static const bool value = std::is_arithmetic<T>::value && !std::is_same<T, bool>::value;
+#else
+  static const bool value = false;
+#endif
+};
+
+/// The vectors and tensors are stored as their LIBMESH_DIM (squared) Reals
+template<>
+struct DataIOBlockCopyable<RealVectorValue>
+{
+  static const bool value = sizeof(RealVectorValue) == LIBMESH_DIM * sizeof(Real);
+};
+
+template<>
+struct DataIOBlockCopyable<Point>
+{
+  static const bool value = sizeof(Point) == LIBMESH_DIM * sizeof(Real);
+};
+
+template<>
+struct DataIOBlockCopyable<RealTensorValue>
+{
+  static const bool value = sizeof(RealTensorValue) == LIBMESH_DIM * LIBMESH_DIM * sizeof(Real);
+};
+
 // global store functions
 
 template<typename T>
@@ -174,6 +207,14 @@ dataStore(std::ostream & stream, std::vector<T> & v, void * context)
   unsigned int size = v.size();
   stream.write((char *) &size, sizeof(size));
 
+  // The block has the same layout as the values stored one at a time
+  if (DataIOBlockCopyable<T>::value)
+  {
+    if (size > 0)
+      stream.write((char *) &v[0], size * sizeof(T));
+    return;
+  }
+
   for (unsigned int i = 0; i < size; i++)
     storeHelper(stream, v[i], context);
 }
@@ -324,6 +365,13 @@ dataLoad(std::istream & stream, std::vector<T> & v, void * context)
 
   v.resize(size);
 
+  if (DataIOBlockCopyable<T>::value)
+  {
+    if (size > 0)
+      stream.read((char *) &v[0], size * sizeof(T));
+    return;
+  }
+
   for (unsigned int i = 0; i < size; i++)
     loadHelper(stream, v[i], context);
 }
@@ -550,6 +598,7 @@ template<>
 inline void
 dataStore(std::ostream & stream, Backup * & backup, void * context)
 {
+  backup->serializeSystemVectors();
   dataStore(stream, backup->_system_data, context);
 
   for (unsigned int i=0; i<backup->_restartable_data.size(); i++)
@@ -28,6 +28,10 @@
 class RestartableDatas;
 class RestartableDataValue;
 class FEProblem;
+class MappedFileBuffer;
+
+/// Hashes of the serialized restartable data values, per thread and by name
+typedef std::vector<std::map<std::string, std::size_t> > RestartableDataHashes;
 
 /**
  * Class for doing restart.
@@ -47,10 +51,33 @@ public:
   void writeRestartableData(std::string base_file_name, const RestartableDatas & restartable_datas, std::set<std::string> & _recoverable_data);
 
   /**
-   * Read restartable data header to verify that we are restarting on the correct number of processors and threads.
+   * Write out the restartable data of a full or a delta checkpoint.
+   * @param hashes The hashes of the values at the last full checkpoint
+   * @param full If true, all values are written and their hashes are stored in hashes; otherwise only the
+   *             values that were added or whose hash changed are written
+   */
+  void writeRestartableData(std::string base_file_name, const RestartableDatas & restartable_datas, RestartableDataHashes & hashes, bool full);
+
+  /**
+   * Set the restartable data of a delta checkpoint.  readRestartableData() reads it after the full
+   * checkpoint data opened by readRestartableDataHeader(), so its values replace the full ones.
+   */
+  void setRestartableDataDelta(const std::string & base_file_name) { _delta_file_base = base_file_name; }
+
+  /**
+   * Read restartable data header to verify that we are restarting on the correct number of threads.
+   * The files are memory mapped when possible, so that only the data that is restored is read.
+   *
+   * With a replicated mesh the data may have been written by a different number of processors, then
+   * readRestartableData() reads the files of all of them, see restartableDataProcessorCount().
    */
   void readRestartableDataHeader(std::string base_file_name);
 
+  /**
+   * The number of processors that wrote the data opened by readRestartableDataHeader()
+   */
+  processor_id_type restartableDataProcessorCount() const { return _in_n_procs; }
+
   /**
    * Read the restartable data.
    */
@@ -58,25 +85,103 @@ public:
 
   /**
    * Create a Backup for the current system.
+   * @param in_memory Copy the system vectors instead of serializing them, see Backup
    */
-  MooseSharedPointer<Backup> createBackup();
+  MooseSharedPointer<Backup> createBackup(bool in_memory = false);
 
   /**
    * Restore a Backup for the current system.
    */
   void restoreBackup(MooseSharedPointer<Backup> backup, bool for_restart = false);
 
+  /**
+   * Write a Backup to a single file, optionally compressed with zlib. Only the Backup is used,
+   * so this can be called on a background thread while the solve modifies the systems.
+   * @param file_name The name of the file, which is written by this processor alone
+   * @param backup The data created by createBackup()
+   * @param n_procs The number of processors of the run, stored to be checked when reading
+   * @param compress Compress the data with the fastest zlib level
+   */
+  static void writeBackup(const std::string & file_name, const Backup & backup, processor_id_type n_procs, bool compress);
+
+  /**
+   * Read a file written by writeBackup() and restore the systems. The restartable data is
+   * restored later, by readRestartableData().
+   */
+  void readBackup(const std::string & file_name);
+
+  /**
+   * Write the manifest of a per-rank checkpoint, it lists the files of the checkpoint and is
+   * written once all of them are complete.
+   * @param file_name The manifest file name
+   * @param mesh_file_name The mesh, written by CheckpointIO
+   * @param data_file_base The base name of the files written by writeBackup(), followed by "-<processor id>"
+   * @param n_procs The number of processors that wrote the data
+   * @param compress True if the data is compressed
+   */
+  static void writeCheckpointManifest(const std::string & file_name, const std::string & mesh_file_name, const std::string & data_file_base, processor_id_type n_procs, bool compress);
+
+  /**
+   * Read the manifest of a per-rank checkpoint, checking that it was written with the current number of processors
+   * @return The name of the data file of this processor
+   */
+  std::string readCheckpointManifest(const std::string & file_name);
+
 private:
+  /**
+   * Copy the system vectors of an in memory Backup back into the systems.
+   */
+  void restoreSystemVectors(const Backup & backup);
+
   /**
    * Serializes the data into the stream object.
    */
   void serializeRestartableData(const std::map<std::string, RestartableDataValue *> & restartable_data, std::ostream & stream);
 
+  /**
+   * Serializes the data that changed since the hashes were recorded, see writeRestartableData()
+   */
+  void serializeChangedRestartableData(const std::map<std::string, RestartableDataValue *> & restartable_data, std::ostream & stream, std::map<std::string, std::size_t> & hashes, bool full);
+
+  /**
+   * Writes the header and the names of the data that follows
+   */
+  void serializeRestartableDataHeader(const std::vector<std::string> & names, std::ostream & stream);
+
+  /**
+   * The name of the restartable data file of a processor and thread
+   */
+  std::string restartableDataFileName(const std::string & base_file_name, THREAD_ID tid, processor_id_type proc_id);
+
+  /**
+   * Opens the restartable data file of a processor and thread in _in_file_handles[tid]
+   */
+  void openRestartableDataFile(const std::string & base_file_name, THREAD_ID tid, processor_id_type proc_id);
+
+  /**
+   * Reads the restartable data written by a different number of processors: every processor reads the files
+   * of all of them, in order.  The HashMaps keyed by element (the stateful material properties) are merged,
+   * so that each processor has the values of the elements it owns after the repartitioning; the other
+   * values are replicated, or are the ones of the last file.
+   */
+  void readRedistributedRestartableData(const RestartableDatas & restartable_datas, const std::set<std::string> & recoverable_data);
+
   /**
    * Deserializes the data from the stream object.
    */
   void deserializeRestartableData(const std::map<std::string, RestartableDataValue *> & restartable_data, std::istream & stream, const std::set<std::string> & recoverable_data);
 
+  /**
+   * Reads the header written by serializeRestartableData() and checks that it matches this run.
+   * @param n_procs The number of processors that wrote the data
+   */
+  void readRestartableDataHeader(std::istream & stream, processor_id_type n_procs);
+
+  /**
+   * Reads the number of processors from the header written by serializeRestartableData()
+   */
+  processor_id_type readRestartableDataProcessorCount(std::istream & stream);
+
   /**
    * Serializes the data for the Systems in FEProblem
    */
@@ -91,7 +196,22 @@ private:
   FEProblem & _fe_problem;
 
   /// A vector of file handles, one per thread
-  std::vector<MooseSharedPointer<std::ifstream> > _in_file_handles;
+  std::vector<MooseSharedPointer<std::istream> > _in_file_handles;
+
+  /// The memory mapped files read by _in_file_handles, one per thread
+  std::vector<MooseSharedPointer<MappedFileBuffer> > _in_file_buffers;
+
+  /// The data read by readBackup(), until the restartable data is read
+  MooseSharedPointer<Backup> _in_backup;
+
+  /// The base name of the delta checkpoint data read after the full data, empty if there is none
+  std::string _delta_file_base;
+
+  /// The base name of the data opened by readRestartableDataHeader()
+  std::string _in_file_base;
+
+  /// The number of processors that wrote the data opened by readRestartableDataHeader()
+  processor_id_type _in_n_procs;
 };
 
 #endif /* RESTARTABLEDATAIO_H */
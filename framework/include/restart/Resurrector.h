@@ -61,6 +61,8 @@ protected:
 
   static const std::string MAT_PROP_EXT;
   static const std::string RESTARTABLE_DATA_EXT;
+  static const std::string MANIFEST_EXT;
+  static const std::string FULL_DATA_EXT;
 };
 
 #endif /* RESURRECTOR_H */
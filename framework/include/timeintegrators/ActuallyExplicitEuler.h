@@ -0,0 +1,83 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef ACTUALLYEXPLICITEULER_H
+#define ACTUALLYEXPLICITEULER_H
+
+#include "TimeIntegrator.h"
+
+class ActuallyExplicitEuler;
+
+template<>
+InputParameters validParams<ActuallyExplicitEuler>();
+
+/**
+ * Explicit Euler time integrator that does not use the nonlinear or linear solvers.
+ *
+ * The lumped (row sum) mass of the time kernels is assembled once, as the difference of
+ * two residuals computed with \f$ \dot{u} = 1 \f$ and \f$ \dot{u} = 0 \f$.  Every time step then
+ * costs a single residual evaluation \f$ R(u^n) \f$ and the update
+ *   \f$ u^{n+1} = u^n - \Delta t M_L^{-1} R(u^n) \f$.
+ * Rows without a lumped mass (e.g. the rows of NodalBCs) are updated with \f$ u^{n+1} = u^n - R(u^n) \f$,
+ * which enforces the boundary conditions exactly when their residual is linear in \f$u\f$.
+ *
+ * The row sum mass is only positive for some discretizations (e.g. first order Lagrange),
+ * and the non-time kernels should be evaluated with implicit = false.  Use solve_type = LINEAR,
+ * otherwise NonlinearSystem::solve() computes an initial residual that is not needed.
+ */
+class ActuallyExplicitEuler : public TimeIntegrator
+{
+public:
+  ActuallyExplicitEuler(const InputParameters & parameters);
+
+  virtual void solve() override;
+  virtual int order() override { return 1; }
+  virtual void computeTimeDerivatives() override;
+  virtual void postStep(NumericVector<Number> & residual) override;
+  virtual void meshChanged() override { _mass_computed = false; }
+
+protected:
+  /// Assemble the lumped mass, leaves the residual with \f$ \dot{u} = 0 \f$ in the system rhs
+  void computeLumpedMass();
+
+  /// How computeTimeDerivatives() sets \f$ \dot{u} \f$
+  enum UDotType
+  {
+    UDOT_DIFFERENCE,
+    UDOT_ZERO,
+    UDOT_ONE
+  };
+
+  /// Whether the lumped mass is recomputed every time step
+  const bool _recompute_mass;
+
+  /// Whether _inverse_mass and _constraint_mask hold the data for the current mesh
+  bool _mass_computed;
+
+  UDotType _u_dot_type;
+
+  /// Minus the inverse of the lumped mass, zero for the rows without mass
+  NumericVector<Number> & _inverse_mass;
+
+  /// Minus one for the rows without mass, zero otherwise
+  NumericVector<Number> & _constraint_mask;
+
+  /// The solution update
+  NumericVector<Number> & _update;
+
+  /// The update of the rows without mass
+  NumericVector<Number> & _constraint_update;
+};
+
+#endif /* ACTUALLYEXPLICITEULER_H */
@@ -0,0 +1,84 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef IMEXRK2_H
+#define IMEXRK2_H
+
+#include "TimeIntegrator.h"
+
+class IMEXRK2;
+
+template<>
+InputParameters validParams<IMEXRK2>();
+
+/**
+ * Second order additive implicit-explicit Runge-Kutta method, ARS(2,2,2) from
+ * U. Ascher, S. Ruuth and R. Spiteri, "Implicit-explicit Runge-Kutta methods for
+ * time-dependent partial differential equations", Appl. Numer. Math., 25 (1997), pg. 151-167.
+ *
+ * The non-time Kernels marked "implicit=false" are integrated with the explicit tableau:
+ * 0     | 0
+ * gamma | gamma 0
+ * 1     | delta 1-delta 0
+ * ---------------------
+ *       | delta 1-delta 0
+ *
+ * and the other non-time Kernels with the L-stable implicit tableau (see LStableDirk2):
+ * 0     | 0
+ * gamma | 0     gamma
+ * 1     | 0     1-gamma gamma
+ * ---------------------
+ *       | 0     1-gamma gamma
+ *
+ * where gamma = 1 - sqrt(2)/2 and delta = 1 - 1/(2*gamma).  The Jacobian only contains the
+ * implicit Kernels, so the stiff terms (e.g. diffusion) are solved for and the non-stiff ones
+ * (e.g. reaction or advection) only cost residual evaluations.
+ *
+ * The residual is always the sum of the implicit and explicit Kernels, so the stage
+ * residuals are built from combinations of saved residuals in which the implicit part of
+ * stage 2 cancels out.  This costs one residual evaluation of stage 2 with the explicit
+ * Kernels evaluated at the stage 2 solution, between the two solves.
+ */
+class IMEXRK2 : public TimeIntegrator
+{
+public:
+  IMEXRK2(const InputParameters & parameters);
+
+  virtual int order() override { return 2; }
+  virtual void computeTimeDerivatives() override;
+  virtual void solve() override;
+  virtual void postStep(NumericVector<Number> & residual) override;
+
+protected:
+  /**
+   * The current stage: 1 for the stage 2 solve, 2 for the evaluation of the residual with the
+   * explicit Kernels at the stage 2 solution and 3 for the final solve
+   */
+  unsigned int _stage;
+
+  /// The solution at the beginning of the time step
+  NumericVector<Number> & _solution_start;
+
+  /// Non-time residual of the first solve, explicit Kernels at the old solution
+  NumericVector<Number> & _residual_stage1;
+
+  /// Non-time residual with every Kernel evaluated at the solution of the first solve
+  NumericVector<Number> & _residual_stage2;
+
+  /// The parameters of the method
+  const Real _gamma;
+  const Real _delta;
+};
+
+#endif /* IMEXRK2_H */
@@ -74,6 +74,11 @@ public:
    */
   virtual void postSolve() {}
 
+  /**
+   * Called after the mesh changed (e.g. by adaptivity), for integrators that keep data on the DOFs
+   */
+  virtual void meshChanged() {}
+
   virtual int order() = 0;
   virtual void computeTimeDerivatives() = 0;
 
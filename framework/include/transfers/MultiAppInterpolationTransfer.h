@@ -17,6 +17,10 @@
 
 // MOOSE includes
 #include "MultiAppTransfer.h"
+#include "KDTree.h"
+
+// libMesh includes
+#include "libmesh/meshfree_interpolation.h"
 
 // Forward declarations
 class MultiAppInterpolationTransfer;
@@ -38,6 +42,20 @@ public:
   virtual void execute() override;
 
 protected:
+  /**
+   * Make the source points and values of all processors available for the interpolation.
+   * @param src_pts The local source points, not used if the search tree is kept from a previous transfer
+   * @param src_vals The local source values
+   * @param idi The libMesh interpolation to use, NULL for the inverse distance interpolation
+   */
+  void prepareSourceData(const std::vector<Point> & src_pts, const std::vector<Number> & src_vals, InverseDistanceInterpolation<LIBMESH_DIM> * idi);
+
+  /**
+   * Interpolate the source values at the supplied points.  The inverse distance
+   * interpolation searches the k-d tree of the source points on all threads.
+   */
+  void interpolate(const std::vector<Point> & pts, std::vector<Real> & vals, InverseDistanceInterpolation<LIBMESH_DIM> * idi) const;
+
   /**
    * Return the nearest node to the point p.
    * @param p The point you want to find the nearest node to.
@@ -55,6 +73,18 @@ protected:
   Real _power;
   MooseEnum _interp_type;
   Real _radius;
+
+  /// Whether the search tree is kept between transfers
+  bool _fixed_meshes;
+
+  /// The source points of all processors
+  std::vector<Point> _src_pts;
+
+  /// The source values of all processors
+  std::vector<Real> _src_vals;
+
+  /// Search tree of _src_pts
+  std::unique_ptr<KDTree> _kd_tree;
 };
 
 #endif /* MULTIAPPINTERPOLATIONTRANSFER_H */
@@ -17,6 +17,9 @@
 
 #include "MultiAppTransfer.h"
 
+// libMesh includes
+#include "libmesh/point_locator_base.h"
+
 // Forward declarations
 class MultiAppMeshFunctionTransfer;
 
@@ -39,9 +42,59 @@ public:
   virtual void execute() override;
 
 protected:
+  /**
+   * The data needed to evaluate the source variable at a point that was
+   * requested by another processor: the dofs of the element containing the
+   * point and the values of the shape functions at the point.
+   */
+  struct CachedEvaluation
+  {
+    /// Index of the local "from" problem, libMesh::invalid_uint if the point was not found
+    unsigned int i_from;
+    std::vector<dof_id_type> dof_indices;
+    std::vector<Real> phi;
+  };
+
+  /// Where the value for a target dof comes from
+  struct CachedTarget
+  {
+    dof_id_type dof;
+
+    /// The processor that evaluates the value, DofObject::invalid_processor_id if no processor found the point
+    processor_id_type proc;
+
+    /// Index of the value in the evaluations returned by proc
+    unsigned int i_pt;
+  };
+
+  /**
+   * Locate the point in the local "from" problem i_from and record the
+   * data needed to evaluate the source variable there.
+   * @return false if the point is not in the mesh of the problem
+   */
+  bool buildEvaluation(unsigned int i_from, PointLocatorBase & locator, const Point & pt, CachedEvaluation & evaluation);
+
+  /// Evaluate the source variable using data recorded by buildEvaluation()
+  Real evaluate(const CachedEvaluation & evaluation, const NumericVector<Number> & from_solution);
+
+  /// Perform a transfer using the cached evaluation plan
+  void executeCached();
+
   AuxVariableName _to_var_name;
   VariableName _from_var_name;
   bool _error_on_miss;
+
+  /// Whether the meshes are not changing, in which case the point locations are cached after the first transfer
+  bool _fixed_meshes;
+
+  /// Whether the evaluation plan has been built
+  bool _plan_cached;
+
+  /// The evaluations requested by each processor, in the order of the points sent by that processor
+  std::vector<std::vector<CachedEvaluation> > _cached_evaluations;
+
+  /// The source of every local target dof, for each "to" problem
+  std::vector<std::vector<CachedTarget> > _cached_targets;
 };
 
 #endif /* MULTIAPPMESHFUNCTIONTRANSFER_H */
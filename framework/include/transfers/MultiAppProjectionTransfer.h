@@ -15,6 +15,7 @@
 #define MULTIAPPPROJECTIONTRANSFER_H
 
 #include "MultiAppTransfer.h"
+#include "MeshChangedInterface.h"
 #include "libmesh/linear_implicit_system.h"
 
 class MultiAppProjectionTransfer;
@@ -24,8 +25,14 @@ InputParameters validParams<MultiAppProjectionTransfer>();
 
 /**
  * Project values from one domain to another
+ *
+ * The projection matrix of every target is assembled on the first transfer
+ * and kept, together with the solver setup, until one of the meshes changes;
+ * later transfers only assemble the right hand side.
  */
-class MultiAppProjectionTransfer : public MultiAppTransfer
+class MultiAppProjectionTransfer :
+  public MultiAppTransfer,
+  public MeshChangedInterface
 {
 public:
   MultiAppProjectionTransfer(const InputParameters & parameters);
@@ -34,6 +41,9 @@ public:
 
   virtual void execute() override;
 
+  /// Forget the projection matrices and the cached quadrature points
+  virtual void meshChanged() override;
+
 protected:
   void toMultiApp();
   void fromMultiApp();
@@ -49,6 +59,13 @@ protected:
 
   /// True, if we need to recompute the projection matrix
   bool _compute_matrix;
+
+  /// Whether the projection matrix (or lumped mass) of each target has been assembled
+  std::vector<bool> _matrix_assembled;
+
+  /// Use a lumped mass matrix instead of solving a linear system
+  bool _lumped_mass;
+
   std::vector<LinearImplicitSystem *> _proj_sys;
   /// Having one projection variable number seems weird, but there is always one variable in every system being used for projection,
   /// thus is always going to be 0 unless something changes in libMesh or we change the way we project variables
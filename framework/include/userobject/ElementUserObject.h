@@ -54,6 +54,12 @@ class ElementUserObject :
 public:
   ElementUserObject(const InputParameters & parameters);
 
+  /**
+   * Whether this object is executed in the element loop of the residual evaluations instead of in
+   * its own loop at timestep_end, see FEProblem::computeUserObjects()
+   */
+  bool fuseWithResidual() const { return _fuse_with_residual; }
+
 protected:
   MooseMesh & _mesh;
 
@@ -67,6 +73,9 @@ protected:
   QBase * & _qrule;
   const MooseArray<Real> & _JxW;
   const MooseArray<Real> & _coord;
+
+  /// Whether this object is executed in the element loop of the residual evaluations
+  const bool _fuse_with_residual;
 };
 
 #endif
@@ -37,6 +37,12 @@ public:
   virtual void finalize() override;
   virtual void threadJoin(const UserObject & y) override;
 
+  ///@{
+  /// The volumes are summed together with the layer values
+  virtual void packLayerData(std::vector<Real> & buffer) const override;
+  virtual void unpackLayerData(const std::vector<Real> & buffer, std::size_t & offset) override;
+  ///@}
+
 protected:
   /// Value of the volume for each layer
   std::vector<Real> _layer_volumes;
@@ -61,6 +61,23 @@ public:
   virtual void finalize();
   virtual void threadJoin(const UserObject & y);
 
+  ///@{
+  /**
+   * Append the data that finalize() sums over the processors to buffer, and replace it by the
+   * summed values starting at buffer[offset] (offset is advanced).  This is used to sum the
+   * data of several objects at once (see NearestPointBase); derived classes with more data to
+   * sum extend these.
+   */
+  virtual void packLayerData(std::vector<Real> & buffer) const;
+  virtual void unpackLayerData(const std::vector<Real> & buffer, std::size_t & offset);
+  ///@}
+
+  /**
+   * Skip the parallel sum in the next finalize(), because the data was already summed with
+   * packLayerData() and unpackLayerData()
+   */
+  void setLayerDataSummed() { _layer_data_summed = true; }
+
 protected:
   /**
    * Set the value for a particular layer
@@ -104,6 +121,12 @@ protected:
   Real _direction_min;
   Real _direction_max;
 
+  /// Whether the bounds are equally spaced, in which case the layer of a point is computed directly
+  bool _uniform_bounds;
+
+  /// The inverse of the spacing of uniform bounds
+  Real _inverse_bounds_spacing;
+
 private:
   /// Value of the integral for each layer
   std::vector<Real> _layer_values;
@@ -116,6 +139,9 @@ private:
 
   /// Whether the values are cumulative over the layers
   bool _cumulative;
+
+  /// Whether the data has been summed over the processors for the next finalize()
+  bool _layer_data_summed;
 };
 
 #endif
@@ -17,6 +17,7 @@
 
 // MOOSE includes
 #include "ElementIntegralVariableUserObject.h"
+#include "KDTree.h"
 
 // Forward Declarations
 class UserObject;
@@ -50,6 +51,9 @@ InputParameters nearestPointBaseValidParams()
  *
  * Given a list of points this object computes the layered average
  * closest to each one of those points.
+ *
+ * UserObjectType must derive from LayeredBase: the layer data of all of
+ * the points is summed over the processors in a single reduction.
  */
 template<typename UserObjectType>
 class NearestPointBase : public ElementIntegralVariableUserObject
@@ -79,10 +83,13 @@ protected:
    * @param p The point.
    * @return The UserObject closest to p.
    */
-  std::shared_ptr<UserObjectType> nearestUserObject(const Point & p) const;
+  const std::shared_ptr<UserObjectType> & nearestUserObject(const Point & p) const;
 
   std::vector<Point> _points;
   std::vector<std::shared_ptr<UserObjectType> > _user_objects;
+
+  /// Search tree over _points
+  std::unique_ptr<KDTree> _point_tree;
 };
 
 
@@ -96,6 +103,11 @@ NearestPointBase<UserObjectType>::NearestPointBase(const InputParameters & param
   // Build each of the UserObject objects:
   for (unsigned int i = 0; i < _points.size(); i++)
     _user_objects.push_back(std::make_shared<UserObjectType>(parameters));
+
+  if (_points.empty())
+    mooseError("No points were supplied to " << name());
+
+  _point_tree = libmesh_make_unique<KDTree>(_points);
 }
 
 template<typename UserObjectType>
@@ -122,8 +134,20 @@ template<typename UserObjectType>
 void
 NearestPointBase<UserObjectType>::finalize()
 {
+  // Pack the data of all of the points into one array and sum it at once
+  std::vector<Real> buffer;
+  for (auto & user_object : _user_objects)
+    user_object->packLayerData(buffer);
+
+  gatherSum(buffer);
+
+  std::size_t offset = 0;
   for (auto & user_object : _user_objects)
+  {
+    user_object->unpackLayerData(buffer, offset);
+    user_object->setLayerDataSummed();
     user_object->finalize();
+  }
 }
 
 template<typename UserObjectType>
@@ -144,19 +168,20 @@ NearestPointBase<UserObjectType>::spatialValue(const Point & p) const
 }
 
 template<typename UserObjectType>
-std::shared_ptr<UserObjectType>
+const std::shared_ptr<UserObjectType> &
 NearestPointBase<UserObjectType>::nearestUserObject(const Point & p) const
 {
-  unsigned int closest = 0;
-  Real closest_distance = std::numeric_limits<Real>::max();
-
-  for (unsigned int i = 0; i < _points.size(); i++)
-  {
-    const Point & current_point = _points[i];
+  std::size_t closest = _point_tree->nearest(p);
+  Real closest_distance = (p - _points[closest]).norm();
 
-    Real current_distance = (p - current_point).norm();
+  // Among points at the same distance the first one is used
+  std::vector<std::size_t> candidates;
+  _point_tree->radiusSearch(p, closest_distance * (1 + 1e-12) + std::numeric_limits<Real>::min(), candidates);
 
-    if (current_distance < closest_distance)
+  for (const auto & i : candidates)
+  {
+    Real current_distance = (p - _points[i]).norm();
+    if (current_distance < closest_distance || (current_distance == closest_distance && i < closest))
     {
       closest_distance = current_distance;
       closest = i;
@@ -36,9 +36,28 @@ public:
   virtual void execute() override;
   virtual void threadJoin(const UserObject & uo) override;
 
+  /**
+   * The normals are not recomputed if they are cached and the mesh did not change.
+   */
+  virtual bool enabled() override;
+
+  /**
+   * Invalidates the cached normals.
+   */
+  virtual void meshChanged() override;
+
 protected:
   AuxiliarySystem & _aux;
   BoundaryID _corner_boundary_id;
+
+  /// Whether the normals are computed only once and after the mesh changes
+  const bool _cache;
+
+  /// Whether the normals were computed on the current mesh
+  bool _computed;
+
+  /// Whether the current execution keeps the normals computed on the current mesh
+  bool _skip;
 };
 
 
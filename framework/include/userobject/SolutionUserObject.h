@@ -28,6 +28,10 @@ class MeshFunction;
 template<class T> class NumericVector;
 }
 
+// C++ includes
+#include <list>
+#include <map>
+
 // Forward declarations
 class SolutionUserObject;
 
@@ -74,6 +78,43 @@ public:
    */
   virtual Real pointValue(Real t, const Point & p, const unsigned int local_var_index) const;
 
+  /**
+   * Returns the values of a variable at a set of locations, giving the same values as pointValue().
+   * The points are visited in spatial order and the element that contained the previous point is
+   * tried before searching the mesh, and both time levels are evaluated from a single search.
+   * @param t The time at which to extract (not used, it is handled automatically when reading the data)
+   * @param points The locations at which to return values
+   * @param var_name The variable to be evaluated
+   * @param values The values of the variable at the points
+   */
+  void pointValues(Real t, const std::vector<Point> & points, const std::string & var_name, std::vector<Real> & values) const;
+
+  /**
+   * Returns the values of a variable at a set of locations, see above
+   * @param local_var_index The local index of the variable to be evaluated
+   */
+  void pointValues(Real t, const std::vector<Point> & points, const unsigned int local_var_index, std::vector<Real> & values) const;
+
+  /**
+   * Returns the values of a variable at a set of locations belonging to an element of the calling
+   * mesh.  The containing element, dofs and shape function values of each point are kept with elem as
+   * the key, so later calls for the same element only combine the stored shape functions with the
+   * current solution.  The points for a given element must not change, which is the case for a fixed
+   * mesh; the stored data is discarded when the mesh of the problem changes.
+   * @param t The time at which to extract (not used, it is handled automatically when reading the data)
+   * @param elem The element of the calling mesh used as the cache key
+   * @param points The locations at which to return values
+   * @param var_name The variable to be evaluated
+   * @param values The values of the variable at the points
+   */
+  void pointValues(Real t, const Elem * elem, const std::vector<Point> & points, const std::string & var_name, std::vector<Real> & values) const;
+
+  /**
+   * Returns the values of a variable at a set of locations belonging to an element, see above
+   * @param local_var_index The local index of the variable to be evaluated
+   */
+  void pointValues(Real t, const Elem * elem, const std::vector<Point> & points, const unsigned int local_var_index, std::vector<Real> & values) const;
+
   /**
    * Return a value directly from a Node
    * @param node A pointer to the node at which a value is desired
@@ -102,6 +143,9 @@ public:
   /// Initialize the System and Mesh objects for the solution being read
   virtual void initialSetup() override;
 
+  /// Discards the evaluations cached by element, which refer to elements of the old mesh
+  virtual void meshChanged() override;
+
 
   const std::vector<std::string> & variableNames() const;
 
@@ -149,6 +193,21 @@ protected:
    */
   bool updateExodusBracketingTimeIndices(Real time);
 
+  /**
+   * Fills a system with an ExodusII time step and localizes it, using the cached copy if there is one
+   * @param index The time index to read
+   * @param system The system (_system or _system2) that receives the data
+   * @param serialized_solution The serialized copy of the solution of the system
+   */
+  void readExodusTimeStep(int index, System & system, NumericVector<Number> & serialized_solution);
+
+  /**
+   * Adds a copy of a serialized time step to the cache, discarding the least recently used step if it is full
+   * @param index The time index of the data
+   * @param serialized_solution The serialized solution for that time index
+   */
+  void cacheExodusTimeStep(int index, const NumericVector<Number> & serialized_solution);
+
   /**
    * A wrapper method for calling the various MeshFunctions used for reading the data
    * @param p The location at which data is desired
@@ -157,6 +216,31 @@ protected:
    */
   Real evalMeshFunction(const Point & p, const unsigned int local_var_index, unsigned int func_num) const;
 
+  /// The data needed to evaluate a variable at a point without searching the mesh again
+  struct PointEvaluation
+  {
+    /// The dofs of the variable on the element containing the point
+    std::vector<dof_id_type> dof_indices;
+
+    /// The shape functions of those dofs at the point
+    std::vector<Real> phi;
+  };
+
+  /// Applies the coordinate transformations, mapping a point of the simulation to a point of the read mesh
+  Point transformPoint(const Point & p) const;
+
+  /**
+   * Locates the points in the read mesh and computes their shape functions
+   * @param points The locations, before transformation
+   * @param local_var_index The local index of the variable to be evaluated
+   * @param evaluations The evaluation data, in the order of points
+   */
+  void buildPointEvaluations(const std::vector<Point> & points, const unsigned int local_var_index,
+                             std::vector<PointEvaluation> & evaluations) const;
+
+  /// The value given by an evaluation, interpolated in time if necessary
+  Real evaluate(const PointEvaluation & evaluation) const;
+
   /// File type to read (0 = xda; 1 = ExodusII)
   MooseEnum _file_type;
 
@@ -229,6 +313,12 @@ protected:
   /// Time index 2, used for interpolation
   int _exodus_index2;
 
+  /// The maximum number of time steps kept in _time_step_cache
+  const unsigned int _time_step_cache_size;
+
+  /// The serialized solutions of the time steps read most recently, the most recently used first
+  std::list<std::pair<int, std::unique_ptr<NumericVector<Number> > > > _time_step_cache;
+
   /// Scale parameter
   std::vector<Real> _scale;
 
@@ -262,6 +352,9 @@ protected:
   /// True if initial_setup has executed
   bool _initialized;
 
+  /// The evaluations computed by pointValues() for an element of the calling mesh and a local variable index
+  mutable std::map<std::pair<const Elem *, unsigned int>, std::vector<PointEvaluation> > _elem_evaluations;
+
 private:
   static Threads::spin_mutex _solution_user_object_mutex;
 };
@@ -23,6 +23,7 @@
 #include "MeshChangedInterface.h"
 #include "ParallelUniqueId.h"
 #include "ScalarCoupleable.h"
+#include "DeferredReduction.h"
 
 // libMesh includes
 #include "libmesh/parallel.h"
@@ -106,24 +107,31 @@ public:
   template <typename T>
   void gatherSum(T & value)
   {
-    _communicator.sum(value);
+    if (!_deferred_reduction.defer(value, DeferredReduction::SUM))
+      _communicator.sum(value);
   }
 
   template <typename T>
   void gatherMax(T & value)
   {
-    _communicator.max(value);
+    if (!_deferred_reduction.defer(value, DeferredReduction::MAX))
+      _communicator.max(value);
   }
 
   template <typename T>
   void gatherMin(T & value)
   {
-    _communicator.min(value);
+    if (!_deferred_reduction.defer(value, DeferredReduction::MIN))
+      _communicator.min(value);
   }
 
   template <typename T1, typename T2>
   void gatherProxyValueMax(T1 & value, T2 & proxy)
   {
+    // Not packed with the other reductions, only skipped if it was already done (see DeferredReduction)
+    if (_deferred_reduction.reduced(value))
+      return;
+
     unsigned int rank;
     _communicator.maxloc(value, rank);
     _communicator.broadcast(proxy, rank);
@@ -142,6 +150,9 @@ protected:
 
   /// Coordinate system
   const Moose::CoordinateSystemType & _coord_sys;
+
+  /// Packs the reductions done by the gather methods of Postprocessors, see FEProblem::finalizeUserObjects()
+  DeferredReduction & _deferred_reduction;
 };
 
 
@@ -0,0 +1,86 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef BICUBICINTERPOLATION_H
+#define BICUBICINTERPOLATION_H
+
+// MOOSE includes
+#include "Moose.h"
+
+// C++ includes
+#include <vector>
+
+/**
+ * Piecewise bicubic Hermite interpolation of tabulated data z(x1, x2) on a (possibly non-uniform)
+ * tensor product grid.  The first derivatives and the cross derivative at the grid points are
+ * estimated with finite differences when the table is set, so the interpolant and its first
+ * derivatives are continuous.  Samples outside of the grid are clamped to the grid.
+ */
+class BicubicInterpolation
+{
+public:
+  /**
+   * @param x1 Strictly increasing grid values in the first direction (at least two)
+   * @param x2 Strictly increasing grid values in the second direction (at least two)
+   * @param z Table of values, z[i][j] is the value at (x1[i], x2[j])
+   */
+  BicubicInterpolation(const std::vector<Real> & x1,
+                       const std::vector<Real> & x2,
+                       const std::vector<std::vector<Real> > & z);
+
+  BicubicInterpolation() = default;
+
+  virtual ~BicubicInterpolation() = default;
+
+  /**
+   * Set the table, see the constructor
+   */
+  void setData(const std::vector<Real> & x1,
+               const std::vector<Real> & x2,
+               const std::vector<std::vector<Real> > & z);
+
+  /**
+   * Sample the interpolant at (x1, x2)
+   */
+  Real sample(Real x1, Real x2) const;
+
+  /**
+   * Sample the interpolant and its derivatives at (x1, x2)
+   */
+  void sampleValueAndDerivatives(Real x1, Real x2, Real & z, Real & dz_dx1, Real & dz_dx2) const;
+
+  /// @return true if (x1, x2) is inside of the tabulated range
+  bool inRange(Real x1, Real x2) const;
+
+protected:
+  void errorCheck() const;
+
+  /// Index of the grid interval containing x (clamped to the grid)
+  unsigned int findInterval(const std::vector<Real> & grid, Real x) const;
+
+  /// Finite difference derivative of values (sampled at grid) at grid point i
+  static Real gridDerivative(const std::vector<Real> & grid, const std::vector<Real> & values, unsigned int i);
+
+  std::vector<Real> _x1;
+  std::vector<Real> _x2;
+
+  ///@{ Values and derivatives at the grid points, indexed [i][j]
+  std::vector<std::vector<Real> > _z;
+  std::vector<std::vector<Real> > _dz_dx1;
+  std::vector<std::vector<Real> > _dz_dx2;
+  std::vector<std::vector<Real> > _d2z_dx1dx2;
+  ///@}
+};
+
+#endif // BICUBICINTERPOLATION_H
@@ -59,14 +59,44 @@ public:
    * This function will take an independent variable input and will
    * return the dependent variable based on the generated fit.
    */
-  Real sample(Real xcoord, Real ycoord);
+  Real sample(Real xcoord, Real ycoord) const;
 
-  void getNeighborIndices(const std::vector<Real> & inArr, Real x ,int& lowerX ,int& upperX );
+  /**
+   * Same as sample(xcoord, ycoord), but the intervals containing the coordinates are looked up
+   * starting from x_hint and y_hint, which are updated to the intervals that were used.  Callers
+   * should keep one pair of hints per thread to get amortized constant time lookups.
+   */
+  Real sample(Real xcoord, Real ycoord, unsigned int & x_hint, unsigned int & y_hint) const;
+
+  /**
+   * Sample the fit at all points (xcoord[i], ycoord[i]) (e.g. all quadrature points of an
+   * element) and store the results in z.  Consecutive lookups reuse the previous intervals.
+   */
+  void sample(const std::vector<Real> & xcoord, const std::vector<Real> & ycoord, std::vector<Real> & z) const;
+
+  void getNeighborIndices(const std::vector<Real> & inArr, Real x ,int& lowerX ,int& upperX ) const;
 
 private:
+  /**
+   * Find the grid points bracketing x on an axis: lowerX == upperX if x is outside the axis or on
+   * one of its points.  The interval is looked up in constant time for uniform axes (spacing > 0),
+   * and otherwise by checking interval_hint and its successor before falling back to a binary
+   * search.
+   */
+  void getNeighborIndices(const std::vector<Real> & inArr, Real spacing, Real x, int & lowerX, int & upperX, unsigned int & interval_hint) const;
+
+  /// The spacing of the points of an axis if they are uniformly spaced, zero otherwise
+  static Real uniformSpacing(const std::vector<Real> & inArr);
+
   std::vector<Real> _xAxis;
   std::vector<Real> _yAxis;
   ColumnMajorMatrix _zSurface;
+
+  ///@{ The spacing of the axes if they are uniform, zero otherwise
+  const Real _x_spacing;
+  const Real _y_spacing;
+  ///@}
+
   static int _file_number;
 };
 
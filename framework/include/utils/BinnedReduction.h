@@ -0,0 +1,84 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef BINNEDREDUCTION_H
+#define BINNEDREDUCTION_H
+
+// MOOSE includes
+#include "MooseTypes.h"
+
+// libMesh includes
+#include "libmesh/parallel.h"
+
+// C++ includes
+#include <vector>
+
+/**
+ * Accumulates several quantities into uniform bins, for the VectorPostprocessors that bin a
+ * statistic over the values of a coordinate or a variable (see VolumeHistogram and
+ * SphericalAverage).
+ *
+ * The quantities of a bin are stored next to each other in a single array, so that the thread
+ * copies are joined with one loop and the processors are summed with one reduction.
+ */
+class BinnedReduction
+{
+public:
+  /**
+   * @param n_bins The number of bins between min and max
+   * @param n_values The number of quantities accumulated in each bin
+   */
+  BinnedReduction(unsigned int n_bins, Real min, Real max, unsigned int n_values);
+
+  /// Returned by bin() for coordinates outside of [min, max)
+  static const unsigned int invalid_bin;
+
+  /// The bin containing x, or invalid_bin
+  unsigned int bin(Real x) const
+  {
+    Real b = (x - _min) / _width;
+    return b >= 0 && b < _n_bins ? static_cast<unsigned int>(b) : invalid_bin;
+  }
+
+  /// Add amount to quantity value of a bin
+  void add(unsigned int bin, unsigned int value, Real amount) { _data[bin * _n_values + value] += amount; }
+
+  /// The accumulated amount of quantity value in a bin
+  Real get(unsigned int bin, unsigned int value) const { return _data[bin * _n_values + value]; }
+
+  /// The center of a bin
+  Real binCenter(unsigned int bin) const { return _min + (bin + 0.5) * _width; }
+
+  unsigned int nBins() const { return _n_bins; }
+
+  /// Set all quantities to zero
+  void clear();
+
+  /// Add the quantities of another object with the same bins, for threadJoin()
+  void join(const BinnedReduction & other);
+
+  /// Sum the quantities over the processors
+  void sum(const Parallel::Communicator & comm) { comm.sum(_data); }
+
+protected:
+  const unsigned int _n_bins;
+  const Real _min;
+  const Real _width;
+  const unsigned int _n_values;
+
+  /// The quantities, bin by bin
+  std::vector<Real> _data;
+};
+
+#endif // BINNEDREDUCTION_H
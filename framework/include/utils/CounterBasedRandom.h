@@ -0,0 +1,94 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef COUNTERBASEDRANDOM_H
+#define COUNTERBASEDRANDOM_H
+
+// MOOSE includes
+#include "MooseTypes.h"
+
+// C++ includes
+#include <stdint.h>
+
+/**
+ * A counter-based random number generator (Philox4x32-10, Salmon et al., "Parallel Random
+ * Numbers: As Easy as 1, 2, 3", SC11).  A number is a pure function of a key and a counter,
+ * so there is no generator state to seed, store or restore: the same key and counter give
+ * the same number on any processor, in any order and on any number of threads.
+ *
+ * The key is made of two 32 bit words (for instance a seed and the time step) and the
+ * counter of an entity id and a draw index.
+ */
+class CounterBasedRandom
+{
+public:
+  /**
+   * Returns a random integer in the range [0, 2^32)
+   * @param seed   first word of the key
+   * @param stream second word of the key, e.g. the time step
+   * @param id     the id of the entity (elem/node) drawing the number
+   * @param index  the index of the draw for this entity, e.g. the qp
+   */
+  static inline uint32_t randl(uint32_t seed, uint32_t stream, dof_id_type id, uint32_t index)
+  {
+    uint32_t ctr[4];
+    block(seed, stream, id, index, ctr);
+    return ctr[0];
+  }
+
+  /**
+   * Returns a random number in the range [0, 1) with 53-bit precision, see randl()
+   * for the description of the arguments.
+   */
+  static inline double rand(uint32_t seed, uint32_t stream, dof_id_type id, uint32_t index)
+  {
+    uint32_t ctr[4];
+    block(seed, stream, id, index, ctr);
+    return ((ctr[0] >> 5) * 67108864.0 + (ctr[1] >> 6)) * (1.0 / 9007199254740992.0);
+  }
+
+private:
+  /// Compute the four output words of the block for the supplied key and counter
+  static inline void block(uint32_t seed, uint32_t stream, dof_id_type id, uint32_t index, uint32_t ctr[4])
+  {
+    uint64_t wide_id = static_cast<uint64_t>(id);
+    ctr[0] = static_cast<uint32_t>(wide_id);
+    ctr[1] = static_cast<uint32_t>(wide_id >> 32);
+    ctr[2] = index;
+    ctr[3] = 0;
+
+    uint32_t key[2] = { seed, stream };
+    for (unsigned int r = 0; r < 10; ++r)
+    {
+      round(key, ctr);
+      key[0] += 0x9E3779B9;
+      key[1] += 0xBB67AE85;
+    }
+  }
+
+  /// One Philox round
+  static inline void round(const uint32_t key[2], uint32_t ctr[4])
+  {
+    uint64_t p0 = static_cast<uint64_t>(0xD2511F53) * ctr[0];
+    uint64_t p1 = static_cast<uint64_t>(0xCD9E8D57) * ctr[2];
+
+    uint32_t c1 = ctr[1];
+    ctr[0] = static_cast<uint32_t>(p1 >> 32) ^ c1 ^ key[0];
+    ctr[1] = static_cast<uint32_t>(p1);
+    ctr[2] = static_cast<uint32_t>(p0 >> 32) ^ ctr[3] ^ key[1];
+    ctr[3] = static_cast<uint32_t>(p0);
+  }
+};
+
+#endif // COUNTERBASEDRANDOM_H
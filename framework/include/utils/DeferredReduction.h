@@ -0,0 +1,165 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef DEFERREDREDUCTION_H
+#define DEFERREDREDUCTION_H
+
+// MOOSE includes
+#include "MooseTypes.h"
+
+// libMesh includes
+#include "libmesh/parallel.h"
+
+// C++ includes
+#include <set>
+#include <type_traits>
+#include <vector>
+
+/**
+ * DeferredReduction packs the parallel reductions of many Postprocessors into one reduction
+ * per operation.
+ *
+ * The values of a set of Postprocessors are computed in two passes:
+ *  - between startRecording() and stopRecording(): the scalar sums, maxima and minima requested
+ *    through UserObject::gatherSum(), gatherMax() and gatherMin() are only recorded, the values
+ *    computed in this pass are discarded,
+ *  - reduce(): every recorded value is reduced in one packed reduction per operation and the
+ *    result is written back, then the values are computed again with the reductions that were
+ *    done skipped.
+ *
+ * Values that can not be packed (vectors, proxies) are reduced immediately in the first pass.
+ */
+class DeferredReduction
+{
+public:
+  enum Operation
+  {
+    SUM,
+    MAX,
+    MIN,
+    N_OPERATIONS
+  };
+
+  DeferredReduction();
+
+  /// Record the reductions instead of doing them, until stopRecording() is called
+  void startRecording();
+
+  /// Do the following reductions immediately again, the values recorded so far are kept
+  void stopRecording();
+
+  /// Reduce the recorded values and start the second pass
+  void reduce(const Parallel::Communicator & comm);
+
+  /// End the second pass and remove the recorded values, the following reductions are done immediately
+  void clear();
+
+  /**
+   * Called by the gather methods of UserObject
+   * @return true if the reduction of value was recorded or has already been done, false if the caller must reduce it now
+   */
+  template <typename T>
+  bool defer(T & value, Operation operation);
+
+  /**
+   * Called for the reductions that are not packed
+   * @return true if the reduction of value was already done in the first pass, false if the caller must reduce it now
+   */
+  template <typename T>
+  bool reduced(T & value);
+
+protected:
+  template <typename T>
+  bool defer(T & value, Operation operation, std::true_type /*arithmetic*/);
+
+  template <typename T>
+  bool defer(T & value, Operation operation, std::false_type /*not arithmetic*/);
+
+  /// A recorded value
+  struct Entry
+  {
+    void * address;
+    void (*write)(void * address, Real value);
+  };
+
+  /// Convert a reduced value back to the type of a recorded value
+  template <typename T>
+  static void write(void * address, Real value) { *static_cast<T *>(address) = static_cast<T>(value); }
+
+  enum Mode
+  {
+    IMMEDIATE,
+    RECORD,
+    APPLY
+  };
+
+  Mode _mode;
+
+  /// The recorded values and their local values for each operation
+  std::vector<Entry> _entries[N_OPERATIONS];
+  std::vector<Real> _values[N_OPERATIONS];
+
+  /// The addresses of the values that were reduced in the first pass
+  std::set<const void *> _reduced;
+};
+
+template <typename T>
+bool
+DeferredReduction::defer(T & value, Operation operation)
+{
+  if (_mode == IMMEDIATE)
+    return false;
+
+  if (_mode == APPLY)
+    return _reduced.count(&value) > 0;
+
+  return defer(value, operation, std::integral_constant<bool, std::is_arithmetic<T>::value>());
+}
+
+template <typename T>
+bool
+DeferredReduction::defer(T & value, Operation operation, std::true_type)
+{
+  if (!_reduced.insert(&value).second)
+    return true;
+
+  Entry entry;
+  entry.address = &value;
+  entry.write = &DeferredReduction::write<T>;
+  _entries[operation].push_back(entry);
+  _values[operation].push_back(value);
+  return true;
+}
+
+template <typename T>
+bool
+DeferredReduction::defer(T & value, Operation /*operation*/, std::false_type)
+{
+  return reduced(value);
+}
+
+template <typename T>
+bool
+DeferredReduction::reduced(T & value)
+{
+  if (_mode == APPLY)
+    return _reduced.count(&value) > 0;
+
+  // Reduced by the caller now, it only must not be reduced again
+  if (_mode == RECORD)
+    _reduced.insert(&value);
+  return false;
+}
+
+#endif // DEFERREDREDUCTION_H
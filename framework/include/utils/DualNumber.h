@@ -0,0 +1,283 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef DUALNUMBER_H
+#define DUALNUMBER_H
+
+#include "MooseTypes.h"
+#include "MooseError.h"
+
+// C++ includes
+#include <array>
+#include <cmath>
+
+/**
+ * Forward mode automatic differentiation: a value together with its derivatives with respect to
+ * N independent quantities.
+ *
+ * The independent quantities are seeded with DualNumber(value, i), typically the values of the
+ * coupled variables and the components of their gradients at a quadrature point.  A residual (or
+ * a material property) computed from them with the usual arithmetic and the functions below
+ * carries its exact derivatives, which the Jacobian contracts with the shape functions:
+ *
+ *   DualNumber<Real, 4> u(_u[_qp], 0);
+ *   ...
+ *   jacobian = r.derivative(0) * _phi[_j][_qp] + r.derivative(1) * _grad_phi[_j][_qp](0) + ...
+ *
+ * The comparison operators compare the values, so branches keep working.  The math functions
+ * are declared in namespace std, so code written for Real (std::exp(x)) also works for
+ * DualNumber.
+ */
+template <typename T, unsigned int N>
+class DualNumber
+{
+public:
+  /// A constant zero
+  DualNumber() :
+      _value(0)
+  {
+    _derivatives.fill(0);
+  }
+
+  /// A constant: all the derivatives are zero
+  DualNumber(const T & value) :
+      _value(value)
+  {
+    _derivatives.fill(0);
+  }
+
+  /// The independent quantity i: its derivative with respect to itself is one
+  DualNumber(const T & value, unsigned int i) :
+      _value(value)
+  {
+    mooseAssert(i < N, "Independent quantity " << i << " out of range");
+    _derivatives.fill(0);
+    _derivatives[i] = 1;
+  }
+
+  ///@{ The value
+  const T & value() const { return _value; }
+  T & value() { return _value; }
+  ///@}
+
+  ///@{ The derivatives with respect to the independent quantities
+  const std::array<T, N> & derivatives() const { return _derivatives; }
+  std::array<T, N> & derivatives() { return _derivatives; }
+  ///@}
+
+  /// The derivative with respect to the independent quantity i
+  const T & derivative(unsigned int i) const { return _derivatives[i]; }
+
+  /// The number of independent quantities
+  static constexpr unsigned int size() { return N; }
+
+  DualNumber operator-() const
+  {
+    DualNumber r(-_value);
+    for (unsigned int i = 0; i < N; ++i)
+      r._derivatives[i] = -_derivatives[i];
+    return r;
+  }
+
+  DualNumber & operator+=(const DualNumber & b)
+  {
+    _value += b._value;
+    for (unsigned int i = 0; i < N; ++i)
+      _derivatives[i] += b._derivatives[i];
+    return *this;
+  }
+
+  DualNumber & operator-=(const DualNumber & b)
+  {
+    _value -= b._value;
+    for (unsigned int i = 0; i < N; ++i)
+      _derivatives[i] -= b._derivatives[i];
+    return *this;
+  }
+
+  DualNumber & operator*=(const DualNumber & b)
+  {
+    for (unsigned int i = 0; i < N; ++i)
+      _derivatives[i] = _derivatives[i] * b._value + _value * b._derivatives[i];
+    _value *= b._value;
+    return *this;
+  }
+
+  DualNumber & operator/=(const DualNumber & b)
+  {
+    const T inv = 1. / b._value;
+    _value *= inv;
+    for (unsigned int i = 0; i < N; ++i)
+      _derivatives[i] = (_derivatives[i] - _value * b._derivatives[i]) * inv;
+    return *this;
+  }
+
+  DualNumber & operator+=(const T & b) { _value += b; return *this; }
+  DualNumber & operator-=(const T & b) { _value -= b; return *this; }
+
+  DualNumber & operator*=(const T & b)
+  {
+    _value *= b;
+    for (unsigned int i = 0; i < N; ++i)
+      _derivatives[i] *= b;
+    return *this;
+  }
+
+  DualNumber & operator/=(const T & b) { return *this *= 1. / b; }
+
+  /**
+   * The chain rule: the function with value f and derivative df at value().  This is how the
+   * math functions below are implemented.
+   */
+  DualNumber chain(const T & f, const T & df) const
+  {
+    DualNumber r(f);
+    for (unsigned int i = 0; i < N; ++i)
+      r._derivatives[i] = df * _derivatives[i];
+    return r;
+  }
+
+protected:
+  /// The value
+  T _value;
+
+  /// The derivatives with respect to the independent quantities
+  std::array<T, N> _derivatives;
+};
+
+///@{ Arithmetic
+template <typename T, unsigned int N>
+inline DualNumber<T, N> operator+(DualNumber<T, N> a, const DualNumber<T, N> & b) { return a += b; }
+template <typename T, unsigned int N>
+inline DualNumber<T, N> operator-(DualNumber<T, N> a, const DualNumber<T, N> & b) { return a -= b; }
+template <typename T, unsigned int N>
+inline DualNumber<T, N> operator*(DualNumber<T, N> a, const DualNumber<T, N> & b) { return a *= b; }
+template <typename T, unsigned int N>
+inline DualNumber<T, N> operator/(DualNumber<T, N> a, const DualNumber<T, N> & b) { return a /= b; }
+
+template <typename T, unsigned int N>
+inline DualNumber<T, N> operator+(DualNumber<T, N> a, const T & b) { return a += b; }
+template <typename T, unsigned int N>
+inline DualNumber<T, N> operator-(DualNumber<T, N> a, const T & b) { return a -= b; }
+template <typename T, unsigned int N>
+inline DualNumber<T, N> operator*(DualNumber<T, N> a, const T & b) { return a *= b; }
+template <typename T, unsigned int N>
+inline DualNumber<T, N> operator/(DualNumber<T, N> a, const T & b) { return a /= b; }
+
+template <typename T, unsigned int N>
+inline DualNumber<T, N> operator+(const T & a, DualNumber<T, N> b) { return b += a; }
+template <typename T, unsigned int N>
+inline DualNumber<T, N> operator-(const T & a, const DualNumber<T, N> & b) { return -b + a; }
+template <typename T, unsigned int N>
+inline DualNumber<T, N> operator*(const T & a, DualNumber<T, N> b) { return b *= a; }
+template <typename T, unsigned int N>
+inline DualNumber<T, N> operator/(const T & a, const DualNumber<T, N> & b)
+{
+  return b.chain(a / b.value(), -a / (b.value() * b.value()));
+}
+///@}
+
+///@{ Comparisons of the values
+#define DUALNUMBER_COMPARISON(op)                                                                 \
+  template <typename T, unsigned int N>                                                           \
+  inline bool operator op(const DualNumber<T, N> & a, const DualNumber<T, N> & b) { return a.value() op b.value(); } \
+  template <typename T, unsigned int N>                                                           \
+  inline bool operator op(const DualNumber<T, N> & a, const T & b) { return a.value() op b; }     \
+  template <typename T, unsigned int N>                                                           \
+  inline bool operator op(const T & a, const DualNumber<T, N> & b) { return a op b.value(); }
+
+DUALNUMBER_COMPARISON(<)
+DUALNUMBER_COMPARISON(<=)
+DUALNUMBER_COMPARISON(>)
+DUALNUMBER_COMPARISON(>=)
+DUALNUMBER_COMPARISON(==)
+DUALNUMBER_COMPARISON(!=)
+
+#undef DUALNUMBER_COMPARISON
+///@}
+
+namespace std
+{
+///@{ Math functions, with the derivatives of the chain rule
+template <typename T, unsigned int N>
+inline DualNumber<T, N> sqrt(const DualNumber<T, N> & a)
+{
+  const T f = std::sqrt(a.value());
+  return a.chain(f, 0.5 / f);
+}
+
+template <typename T, unsigned int N>
+inline DualNumber<T, N> exp(const DualNumber<T, N> & a)
+{
+  const T f = std::exp(a.value());
+  return a.chain(f, f);
+}
+
+template <typename T, unsigned int N>
+inline DualNumber<T, N> log(const DualNumber<T, N> & a) { return a.chain(std::log(a.value()), 1. / a.value()); }
+
+template <typename T, unsigned int N>
+inline DualNumber<T, N> sin(const DualNumber<T, N> & a) { return a.chain(std::sin(a.value()), std::cos(a.value())); }
+
+template <typename T, unsigned int N>
+inline DualNumber<T, N> cos(const DualNumber<T, N> & a) { return a.chain(std::cos(a.value()), -std::sin(a.value())); }
+
+template <typename T, unsigned int N>
+inline DualNumber<T, N> tan(const DualNumber<T, N> & a)
+{
+  const T f = std::tan(a.value());
+  return a.chain(f, 1. + f * f);
+}
+
+template <typename T, unsigned int N>
+inline DualNumber<T, N> tanh(const DualNumber<T, N> & a)
+{
+  const T f = std::tanh(a.value());
+  return a.chain(f, 1. - f * f);
+}
+
+template <typename T, unsigned int N>
+inline DualNumber<T, N> atan(const DualNumber<T, N> & a)
+{
+  return a.chain(std::atan(a.value()), 1. / (1. + a.value() * a.value()));
+}
+
+template <typename T, unsigned int N>
+inline DualNumber<T, N> abs(const DualNumber<T, N> & a) { return a.value() < 0 ? -a : a; }
+
+template <typename T, unsigned int N>
+inline DualNumber<T, N> fabs(const DualNumber<T, N> & a) { return a.value() < 0 ? -a : a; }
+
+template <typename T, unsigned int N>
+inline DualNumber<T, N> pow(const DualNumber<T, N> & a, const T & b)
+{
+  return a.chain(std::pow(a.value(), b), b * std::pow(a.value(), b - 1));
+}
+
+template <typename T, unsigned int N>
+inline DualNumber<T, N> pow(const T & a, const DualNumber<T, N> & b)
+{
+  const T f = std::pow(a, b.value());
+  return b.chain(f, f * std::log(a));
+}
+
+template <typename T, unsigned int N>
+inline DualNumber<T, N> pow(const DualNumber<T, N> & a, const DualNumber<T, N> & b)
+{
+  return std::exp(b * std::log(a));
+}
+///@}
+}
+
+#endif // DUALNUMBER_H
@@ -0,0 +1,67 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef ELEMENTCOSTLOG_H
+#define ELEMENTCOSTLOG_H
+
+// MOOSE includes
+#include "MooseTypes.h"
+
+// C++ includes
+#include <chrono>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * ElementCostLog records the wall time spent computing the residual of each
+ * element, for partitioners that balance the measured cost instead of the
+ * number of elements (see CostWeightedPartitioner).
+ *
+ * Each thread accumulates into its own table, so the residual loop needs no
+ * locking.  Logging is off by default.
+ */
+class ElementCostLog
+{
+public:
+  typedef std::chrono::steady_clock Clock;
+
+  ElementCostLog();
+
+  /// Start recording; sizes the per-thread tables, so call this after libMesh is initialized
+  void enable();
+
+  /// True if costs are being recorded
+  bool enabled() const { return _enabled; }
+
+  /// Remove all recorded costs
+  void clear();
+
+  /// Add the time between start and now to the cost of an element
+  void add(THREAD_ID tid, dof_id_type elem_id, const Clock::time_point & start)
+  {
+    _costs[tid][elem_id] += std::chrono::duration<Real>(Clock::now() - start).count();
+  }
+
+  /// The recorded time of each element, in seconds, summed over all threads of this processor
+  std::unordered_map<dof_id_type, Real> costs() const;
+
+protected:
+  /// Whether costs are being recorded
+  bool _enabled;
+
+  /// The recorded costs, indexed by thread and element id
+  std::vector<std::unordered_map<dof_id_type, Real> > _costs;
+};
+
+#endif // ELEMENTCOSTLOG_H
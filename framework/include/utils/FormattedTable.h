@@ -91,6 +91,21 @@ public:
    */
   void printCSV(const std::string & file_name, int interval=1, bool align = false);
 
+  /**
+   * Make printCSV() write only the rows that were added or changed since the previous call,
+   * instead of the entire table.  After every write the oldest rows are removed from memory
+   * so that at most window rows are kept (0 keeps all rows), see trim().
+   *
+   * The file is rewritten only if the columns (or, with align, the column widths) change; the
+   * rows that are no longer in memory are then copied from the existing file.
+   */
+  void setIncremental(bool incremental, unsigned int window);
+
+  /**
+   * Remove the oldest rows so that at most n_rows rows are kept, the last row is always kept
+   */
+  void trim(unsigned int n_rows);
+
   void printEnsight(const std::string & file_name);
   void writeExodus(ExodusII_IO * ex_out, Real time);
   void makeGnuplot(const std::string & base_file, const std::string & format);
@@ -121,6 +136,24 @@ protected:
                       std::ostream & out, std::map<std::string, unsigned short> & col_widths,
                       std::set<std::string>::iterator & col_begin, std::set<std::string>::iterator & col_end) const;
 
+  ///@{
+  /**
+   * Write the header and a single row of the csv file, the widths are used with align = true
+   */
+  void printCSVHeader(std::ostream & out, std::map<std::string, unsigned int> & width, bool align) const;
+  void printCSVRow(std::ostream & out, Real key, std::map<std::string, Real> & row,
+                   std::map<std::string, unsigned int> & width, bool align) const;
+  ///@}
+
+  /// The incremental version of printCSV()
+  void printCSVIncremental(const std::string & file_name, bool align);
+
+  /**
+   * Read the first n_rows data rows of an existing csv file written by printCSV(), as strings
+   * indexed by column name
+   */
+  std::vector<std::map<std::string, std::string> > readCSVRows(const std::string & file_name, std::size_t n_rows) const;
+
 
   /**
    * Returns the width of the terminal using sys/ioctl
@@ -154,6 +187,30 @@ protected:
   /// Whether or not to output the Time column
   bool _output_time;
 
+  /// Whether printCSV() only writes the new rows, see setIncremental()
+  bool _incremental;
+
+  /// The number of rows kept in memory by the incremental output
+  unsigned int _window;
+
+  /// The number of rows removed from the beginning of _data by trim()
+  std::size_t _n_trimmed_rows;
+
+  /// The smallest key added or changed since the last incremental write
+  Real _first_modified_key;
+
+  ///@{
+  /// The columns and widths the csv file header was written with
+  std::set<std::string> _csv_columns;
+  std::map<std::string, unsigned int> _csv_widths;
+  ///@}
+
+  /// The positions in the csv file of the written rows that are in _data
+  std::map<Real, std::streampos> _csv_row_positions;
+
+  /// The position after the last row in the csv file
+  std::streampos _csv_end;
+
 private:
 
   /// *.csv file delimiter, defaults to ","
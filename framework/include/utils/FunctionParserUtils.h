@@ -41,11 +41,33 @@ protected:
   /// Evaluate FParser object and check EvalError
   Real evaluate(ADFunctionPtr &);
 
+  /// Evaluate FParser object with the supplied parameters and check EvalError
+  Real evaluate(ADFunctionPtr &, const Real * params);
+
   /// add constants (which can be complex expressions) to the parser object
   void addFParserConstants(ADFunctionPtr & parser,
                            const std::vector<std::string> & constant_names,
                            const std::vector<std::string> & constant_expressions);
 
+  /**
+   * JIT compile the parser object, reusing the compiled code of an earlier parser with the
+   * same key. Parsed objects with identical expressions (on other blocks, threads or
+   * MultiApps in the same process) are then compiled only once.
+   * @param parser The parser, it is replaced by a copy of the cached parser if one exists
+   * @param key A string that uniquely describes the parser content, see jitCacheKey()
+   * @return false if the compilation failed
+   */
+  bool jitCompile(ADFunctionPtr & parser, const std::string & key);
+
+  /**
+   * Build a key for jitCompile() from the arguments used to set up a parser, further
+   * content (e.g. derivative variables) may be appended by the caller
+   */
+  static std::string jitCacheKey(const std::string & expression,
+                                 const std::string & variables,
+                                 const std::vector<std::string> & constant_names,
+                                 const std::vector<std::string> & constant_expressions);
+
   //@{ feature flags
   bool _enable_jit;
   bool _enable_ad_cache;
@@ -44,7 +44,10 @@ public:
    */
   GriddedData(std::string file_name);
 
-  virtual ~GriddedData() = default;
+  virtual ~GriddedData();
+
+  GriddedData(const GriddedData &) = delete;
+  GriddedData & operator=(const GriddedData &) = delete;
 
   /**
    * Returns the dimensionality of the grid.
@@ -81,6 +84,12 @@ public:
    */
   Real evaluateFcn(const std::vector<unsigned int> & ijk);
 
+  /**
+   * The function value with the given flat index,
+   * f[i,j,k,l] has index i + j*Ni + k*Ni*Nj + l*Ni*Nj*Nk
+   */
+  Real fcnValue(std::size_t index) const { return _fcn_data[index]; }
+
 private:
   unsigned int _dim;
   std::vector<int> _axes;
@@ -88,7 +97,25 @@ private:
   std::vector<Real> _fcn;
   std::vector<unsigned int> _step;
 
+  /// The function values, either _fcn or the values in the memory mapped binary file
+  const Real * _fcn_data;
+
+  /// The number of function values
+  std::size_t _n_fcn;
+
+  /// The memory mapped binary file, NULL for the text format
+  void * _mapped;
+
+  /// The size of the memory mapped file in bytes
+  std::size_t _mapped_size;
+
   void parse(unsigned int & dim, std::vector<int> & axes, std::vector<std::vector<Real> > & grid, std::vector<Real> & f, std::vector<unsigned int> & step, std::string file_name);
+
+  /**
+   * Memory map file_name if it is in the binary format, see GriddedData.C
+   * @return false if the file is not in the binary format
+   */
+  bool mapBinary(const std::string & file_name);
   bool getSignificantLine(std::ifstream & file_stream, std::string & line);
   void splitToRealVec(const std::string & input_string, std::vector<Real> & output_vec);
 };
@@ -43,6 +43,7 @@
 #include "vtkImageShiftScale.h"
 #include "vtkImageMagnitude.h"
 #include "vtkImageFlip.h"
+#include "vtkExtractVOI.h"
 
 #ifdef __clang__
 #pragma clang diagnostic pop
@@ -112,6 +113,12 @@ protected:
    */
   void vtkFlip();
 
+  /**
+   * Read only the voxels around the local elements of the mesh, every "downsample"-th voxel in
+   * each direction.  The flips are applied when sampling, since the part that is read depends on them.
+   */
+  void vtkExtractLocal(MooseMesh & mesh);
+
 private:
 
 #ifdef LIBMESH_HAVE_VTK
@@ -139,6 +146,9 @@ private:
 
   /// Pointers to image flipping filter.  May be used for x, y, or z.
   vtkSmartPointer<vtkImageFlip> _flip_filter;
+
+  /// The filter that selects the part of the image that is read
+  vtkSmartPointer<vtkExtractVOI> _extract_filter;
 #endif
 
   /**
@@ -162,6 +172,18 @@ private:
   /// Physical pixel size
   std::vector<double> _voxel;
 
+  /// Whether only the part of the image around the local elements is read
+  const bool _local_image;
+
+  /// The number of voxels around the local elements that are read
+  const unsigned int _local_padding;
+
+  /// Only every n-th voxel in each direction is read
+  const unsigned int _downsample;
+
+  /// Whether the image is flipped along each axis, when the flips are applied by sample()
+  bool _flip[3];
+
   /// Component to extract
 #ifdef LIBMESH_HAVE_VTK
   unsigned int _component;
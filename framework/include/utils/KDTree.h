@@ -0,0 +1,99 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef KDTREE_H
+#define KDTREE_H
+
+// MOOSE includes
+#include "Moose.h" // using namespace libMesh
+
+// libMesh includes
+#include "libmesh/point.h"
+
+// C++ includes
+#include <queue>
+#include <vector>
+
+/**
+ * A simple k-d tree over a fixed set of points supporting k-nearest neighbor and radius searches.
+ * The tree stores a copy of the points, so it has to be rebuilt when the points move.
+ */
+class KDTree
+{
+public:
+  /**
+   * @param points The points to build the tree for.  Search results are indices into this vector.
+   * @param max_leaf_size The maximum number of points stored in a leaf of the tree
+   */
+  KDTree(const std::vector<Point> & points, unsigned int max_leaf_size = 10);
+
+  virtual ~KDTree() = default;
+
+  /**
+   * Find the (up to) patch_size points closest to query_point.
+   * @param return_index Filled with the indices of the found points sorted by increasing distance
+   */
+  void neighborSearch(const Point & query_point, unsigned int patch_size, std::vector<std::size_t> & return_index) const;
+
+  /**
+   * Find all points within radius of query_point (in no particular order).
+   */
+  void radiusSearch(const Point & query_point, Real radius, std::vector<std::size_t> & return_index) const;
+
+  /**
+   * @return The index of the point closest to query_point.  Only valid for a non-empty tree.
+   */
+  std::size_t nearest(const Point & query_point) const;
+
+  /// The number of points in the tree
+  std::size_t size() const { return _points.size(); }
+
+protected:
+  /// Node of the tree.  Leaves have _left == _right == invalid_node.
+  struct TreeNode
+  {
+    unsigned int _split_dim;
+    Real _split_value;
+    std::size_t _begin;
+    std::size_t _end;
+    std::size_t _left;
+    std::size_t _right;
+  };
+
+  /// Max-heap of (squared distance, point index) used by the k-nearest neighbor search
+  typedef std::priority_queue<std::pair<Real, std::size_t> > NeighborHeap;
+
+  /// Recursively build the subtree holding the points _index[begin, end), returns the node index
+  std::size_t build(std::size_t begin, std::size_t end);
+
+  void knnSearch(std::size_t node, const Point & query_point, unsigned int k, NeighborHeap & heap) const;
+
+  void radiusSearch(std::size_t node, const Point & query_point, Real radius_sq, std::vector<std::size_t> & return_index) const;
+
+  static const std::size_t invalid_node;
+
+  /// Copy of the points
+  std::vector<Point> _points;
+
+  /// Permutation of the point indices, each tree node owns a contiguous range of it
+  std::vector<std::size_t> _index;
+
+  /// The tree nodes, the root is the first one
+  std::vector<TreeNode> _nodes;
+
+  /// The maximum number of points in a leaf
+  unsigned int _max_leaf_size;
+};
+
+#endif // KDTREE_H
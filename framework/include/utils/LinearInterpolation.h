@@ -59,12 +59,30 @@ public:
    */
   Real sample(Real x) const;
 
+  /**
+   * Same as sample(x), but the interval containing x is looked up starting from interval_hint, which is
+   * updated to the interval that was used.  Callers that sample monotonically (e.g. in time or along a
+   * line) should keep one hint per thread to get amortized constant time lookups.
+   */
+  Real sample(Real x, unsigned int & interval_hint) const;
+
+  /**
+   * Sample the fit at all values in x (e.g. all quadrature points of an element) and store the results in y.
+   * Consecutive lookups reuse the previous interval.
+   */
+  void sample(const std::vector<Real> & x, std::vector<Real> & y) const;
+
   /**
    * This function will take an independent variable input and will return the derivative of the dependent variable
    * with respect to the independent variable based on the generated fit
    */
   Real sampleDerivative(Real x) const;
 
+  /**
+   * Same as sampleDerivative(x) using and updating an interval hint, see sample(Real, unsigned int &)
+   */
+  Real sampleDerivative(Real x, unsigned int & interval_hint) const;
+
   /**
    * This function will dump GNUPLOT input files that can be run to show the data points and
    * function fits
@@ -85,6 +103,11 @@ public:
   Real range(int i) const;
 
 private:
+  /**
+   * Find the interval i with _x[i] <= x < _x[i+1], checking interval_hint and its successor before falling
+   * back to a binary search.  x must be strictly inside the data range.
+   */
+  unsigned int findInterval(Real x, unsigned int interval_hint) const;
 
   std::vector<Real> _x;
   std::vector<Real> _y;
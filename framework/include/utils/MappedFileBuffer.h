@@ -0,0 +1,59 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef MAPPEDFILEBUFFER_H
+#define MAPPEDFILEBUFFER_H
+
+// C++ includes
+#include <streambuf>
+#include <string>
+
+/**
+ * A std::streambuf over a read-only memory mapping of a file.
+ *
+ * An std::istream constructed on it reads straight from the mapped pages, so a
+ * read is a single copy and skipping data with seekg() does not touch the
+ * skipped pages at all.  This is used for the restart files, which are read
+ * once and mostly in large blocks.
+ */
+class MappedFileBuffer : public std::streambuf
+{
+public:
+  /**
+   * Map the file; if it can not be mapped (e.g. it is empty or mmap is not supported
+   * by the file system) mapped() is false and the buffer is empty.
+   */
+  MappedFileBuffer(const std::string & file_name);
+
+  virtual ~MappedFileBuffer();
+
+  /// True if the file has been mapped
+  bool mapped() const { return _data != NULL; }
+
+protected:
+  virtual pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which = std::ios_base::in) override;
+  virtual pos_type seekpos(pos_type pos, std::ios_base::openmode which = std::ios_base::in) override;
+
+  /// The start of the mapping
+  char * _data;
+
+  /// The size of the file
+  std::size_t _size;
+
+private:
+  MappedFileBuffer(const MappedFileBuffer &) = delete;
+  MappedFileBuffer & operator=(const MappedFileBuffer &) = delete;
+};
+
+#endif // MAPPEDFILEBUFFER_H
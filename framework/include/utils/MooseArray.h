@@ -16,8 +16,17 @@
 #define ARRAY_H
 
 #include <vector>
+#include <new>
+#include <stdint.h>
 #include "MooseError.h"
 
+/**
+ * MooseArray is the storage for the quadrature point data (variable values, JxW,
+ * material properties).  The storage is aligned to a cache line and never shrinks:
+ * resize() only allocates when the requested size exceeds the capacity, so
+ * alternating between elements with different numbers of quadrature points
+ * does not reallocate.
+ */
 
 template<typename T>
 class MooseArray
@@ -28,6 +37,7 @@ public:
    */
   MooseArray() :
     _data(NULL),
+    _raw(NULL),
     _size(0),
     _allocated_size(0)
   {}
@@ -38,6 +48,7 @@ public:
   explicit
   MooseArray(const unsigned int size) :
     _data(NULL),
+    _raw(NULL),
     _allocated_size(0)
   {
     resize(size);
@@ -50,6 +61,7 @@ public:
   explicit
   MooseArray(const unsigned int size, const T & default_value) :
     _data(NULL),
+    _raw(NULL),
     _allocated_size(0)
   {
     resize(size);
@@ -70,7 +82,7 @@ public:
   {
     if (_data != NULL)
     {
-      delete [] _data;
+      deallocate();
       _data = NULL;
       _allocated_size = _size = 0;
     }
@@ -120,6 +132,17 @@ public:
    */
   unsigned int size() const;
 
+  /**
+   * The number of elements that can be stored without reallocating.
+   */
+  unsigned int capacity() const { return _allocated_size; }
+
+  /**
+   * Pointer to the contiguous, cache line aligned, storage (for vectorized loops).
+   */
+  T * data() { return _data; }
+  const T * data() const { return _data; }
+
   /**
    * Get element i out of the array.
    */
@@ -187,11 +210,25 @@ public:
    */
   std::vector<T> stdVector();
 
+  /// Alignment of the storage in bytes
+  static const std::size_t ALIGNMENT = 64;
+
 private:
+  /**
+   * Allocate storage for at least size elements (rounded up to fill the last cache line),
+   * and set _data, _raw and _allocated_size.  Does not free the previous storage.
+   */
+  void allocate(const unsigned int size);
+
+  /// Destroy the elements and free the storage, if this array owns it
+  void deallocate();
 
   /// Actual data pointer.
   T * _data;
 
+  /// The block _data lives in, NULL if the storage belongs to a std::vector (see shallowCopy())
+  void * _raw;
+
   /// The current number of elements the array can hold.
   unsigned int _size;
 
@@ -199,6 +236,38 @@ private:
   unsigned int _allocated_size;
 };
 
+template<typename T>
+inline
+void
+MooseArray<T>::allocate(const unsigned int size)
+{
+  std::size_t bytes = ((size * sizeof(T) + ALIGNMENT - 1) / ALIGNMENT) * ALIGNMENT;
+  unsigned int capacity = bytes / sizeof(T);
+
+  _raw = ::operator new(bytes + ALIGNMENT);
+  uintptr_t address = reinterpret_cast<uintptr_t>(_raw);
+  _data = reinterpret_cast<T *>((address + ALIGNMENT) & ~static_cast<uintptr_t>(ALIGNMENT - 1));
+
+  for (unsigned int i = 0; i < capacity; ++i)
+    new (_data + i) T;
+
+  _allocated_size = capacity;
+}
+
+template<typename T>
+inline
+void
+MooseArray<T>::deallocate()
+{
+  if (_raw == NULL)
+    return;
+
+  for (unsigned int i = 0; i < _allocated_size; ++i)
+    _data[i].~T();
+  ::operator delete(_raw);
+  _raw = NULL;
+}
+
 template<typename T>
 inline
 void
@@ -221,19 +290,14 @@ inline
 void
 MooseArray<T>::resize(const unsigned int size)
 {
-  if (size <= _allocated_size)
-    _size = size;
-  else
+  if (size > _allocated_size)
   {
-    T * new_pointer = new T[size];
-    mooseAssert(new_pointer, "Failed to allocate MooseArray memory!");
-
     if (_data != NULL)
-      delete [] _data;
-    _data = new_pointer;
-    _allocated_size = size;
-    _size = size;
+      deallocate();
+    allocate(size);
   }
+
+  _size = size;
 }
 
 template<typename T>
@@ -243,18 +307,24 @@ MooseArray<T>::resize(const unsigned int size, const T & default_value)
 {
   if (size > _allocated_size)
   {
-    T * new_pointer = new T[size];
-    mooseAssert(new_pointer, "Failed to allocate MooseArray memory!");
+    T * old_data = _data;
+    void * old_raw = _raw;
+    unsigned int old_allocated_size = _allocated_size;
 
-    if (_data != NULL)
+    allocate(size);
+
+    if (old_data != NULL)
     {
       for (unsigned int i=0; i<_size; i++)
-        new_pointer[i] = _data[i];
-      delete [] _data;
+        _data[i] = old_data[i];
+
+      if (old_raw != NULL)
+      {
+        for (unsigned int i = 0; i < old_allocated_size; ++i)
+          old_data[i].~T();
+        ::operator delete(old_raw);
+      }
     }
-
-    _data = new_pointer;
-    _allocated_size = size;
   }
 
   for (unsigned int i=_size; i<size; i++)
@@ -297,6 +367,7 @@ void
 MooseArray<T>::swap(MooseArray & rhs)
 {
   std::swap(_data, rhs._data);
+  std::swap(_raw, rhs._raw);
   std::swap(_size, rhs._size);
   std::swap(_allocated_size, rhs._allocated_size);
 }
@@ -307,6 +378,7 @@ void
 MooseArray<T>::shallowCopy(const MooseArray & rhs)
 {
   _data = rhs._data;
+  _raw = rhs._raw;
   _size = rhs._size;
   _allocated_size = rhs._allocated_size;
 }
@@ -317,6 +389,7 @@ void
 MooseArray<T>::shallowCopy(std::vector<T> & rhs)
 {
   _data = &rhs[0];
+  _raw = NULL;
   _size = rhs.size();
   _allocated_size = rhs.size();
 }
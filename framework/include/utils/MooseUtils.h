@@ -265,6 +265,38 @@ namespace MooseUtils
    */
   std::string getRecoveryFileBase(const std::list<std::string> & checkpoint_files);
 
+  /**
+   * The physical memory (resident set size) of this process in bytes, or the
+   * peak if the current size cannot be read on this platform
+   */
+  std::size_t residentMemory();
+
+  /**
+   * The largest physical memory (resident set size) this process has used, in bytes
+   */
+  std::size_t peakResidentMemory();
+
+  /**
+   * Estimate of the heap memory held by a std::vector of values without heap storage of their own
+   */
+  template <typename T>
+  std::size_t
+  vectorMemory(const std::vector<T> & v)
+  {
+    return v.capacity() * sizeof(T);
+  }
+
+  /**
+   * Estimate of the heap memory held by a std::map or std::set of values without heap storage of
+   * their own: each entry is a tree node holding the value, three pointers and the color
+   */
+  template <typename T>
+  std::size_t
+  treeMemory(const T & container)
+  {
+    return container.size() * (sizeof(typename T::value_type) + 4 * sizeof(void *));
+  }
+
 
   /**
    * This function will split the passed in string on a set of delimiters appending the substrings
@@ -0,0 +1,173 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef OBJECTPERFLOG_H
+#define OBJECTPERFLOG_H
+
+// MOOSE includes
+#include "MooseTypes.h"
+#include "TraceLog.h"
+
+// C++ includes
+#include <chrono>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+// Forward declarations
+class MooseObject;
+
+/**
+ * ObjectPerfLog records the number of calls and the wall time spent in the
+ * computeResidual, computeJacobian and computeProperties methods of individual
+ * objects, so that a slow residual evaluation can be attributed to a Kernel,
+ * BC or Material.
+ *
+ * Each thread accumulates into its own table, so the compute loops need no
+ * locking.  The tables are merged by object name when they are queried.
+ * Logging is off by default, in which case a Timer costs a single branch.
+ */
+class ObjectPerfLog
+{
+public:
+  /// The hot-path methods that are timed
+  enum Category
+  {
+    RESIDUAL,
+    JACOBIAN,
+    PROPERTIES,
+    N_CATEGORIES
+  };
+
+  /// The accumulated data for an object
+  struct Entry
+  {
+    Entry() : count(0), time(0.) {}
+
+    /// Name of the object
+    std::string name;
+
+    /// Number of calls
+    unsigned long int count;
+
+    /// Total wall time in seconds
+    Real time;
+  };
+
+  /**
+   * Scoped timer: adds the time between construction and destruction to the
+   * entry of the supplied object, and records it in Moose::trace_log if the
+   * per-object trace events are enabled.  Does nothing if logging is disabled.
+   */
+  class Timer
+  {
+  public:
+    Timer(Category category, const MooseObject * object, THREAD_ID tid);
+    ~Timer();
+
+  private:
+    Entry * _entry;
+    Category _category;
+    THREAD_ID _tid;
+    TraceLog::Clock::time_point _start;
+  };
+
+  ObjectPerfLog();
+
+  /// Start recording; sizes the per-thread tables, so call this after libMesh is initialized
+  void enable();
+
+  /// Stop recording, the data collected so far is kept
+  void disable() { _enabled = false; }
+
+  /// True if timings are being recorded
+  bool enabled() const { return _enabled; }
+
+  /// Remove all recorded data
+  void clear();
+
+  /**
+   * The data for an object, summed over all threads.  The entry will have
+   * count == 0 if the object has not been recorded in this category.
+   */
+  Entry get(Category category, const std::string & name) const;
+
+  /// The data for all objects in a category, summed over all threads and sorted by name
+  std::map<std::string, Entry> summary(Category category) const;
+
+  /// Print a table listing every recorded object, most expensive first
+  void print(std::ostream & os) const;
+
+  /// Write the table produced by print() as comma separated values
+  void printCSV(const std::string & file_name) const;
+
+  /// The name of a category ("computeResidual", "computeJacobian" or "computeProperties")
+  static const std::string & categoryName(Category category);
+
+  /**
+   * Convert a category name to a Category
+   * @return true if name is one of the names returned by categoryName()
+   */
+  static bool categoryFromName(const std::string & name, Category & category);
+
+protected:
+  /// The entry that thread tid uses for the object
+  Entry & entry(Category category, const MooseObject * object, THREAD_ID tid);
+
+  /// All entries, sorted by decreasing time
+  std::vector<std::pair<Category, Entry> > sortedEntries() const;
+
+  /// Whether timings are being recorded
+  bool _enabled;
+
+  /// The recorded data, indexed by thread and category
+  std::vector<std::vector<std::unordered_map<const MooseObject *, Entry> > > _data;
+};
+
+namespace Moose
+{
+/**
+ * Object timings recorded by the compute loops.  Enabled by the "object_perf_log"
+ * options of the Console and CSV outputs, by a PerformanceData postprocessor
+ * that requests one of the object categories, or by the "object_events" option
+ * of the ChromeTrace output.
+ */
+extern ObjectPerfLog object_perf_log;
+}
+
+inline
+ObjectPerfLog::Timer::Timer(Category category, const MooseObject * object, THREAD_ID tid) :
+    _entry(Moose::object_perf_log.enabled() ? &Moose::object_perf_log.entry(category, object, tid) : NULL),
+    _category(category),
+    _tid(tid)
+{
+  if (_entry)
+    _start = TraceLog::Clock::now();
+}
+
+inline
+ObjectPerfLog::Timer::~Timer()
+{
+  if (_entry)
+  {
+    TraceLog::Clock::time_point end = TraceLog::Clock::now();
+    _entry->time += std::chrono::duration<Real>(end - _start).count();
+    _entry->count++;
+
+    if (Moose::trace_log.objectEvents())
+      Moose::trace_log.addEvent(_tid, _entry->name, ObjectPerfLog::categoryName(_category), _start, end);
+  }
+}
+
+#endif // OBJECTPERFLOG_H
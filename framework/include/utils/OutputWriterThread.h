@@ -0,0 +1,108 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef OUTPUTWRITERTHREAD_H
+#define OUTPUTWRITERTHREAD_H
+
+// MOOSE includes
+#include "MooseTypes.h"
+
+// libMesh includes
+#include "libmesh/libmesh_config.h"
+
+// Currently the OutputWriterThread requires std::thread and std::condition_variable
+#if defined(LIBMESH_HAVE_CXX11_THREAD) && defined(LIBMESH_HAVE_CXX11_CONDITION_VARIABLE)
+
+// C++ includes
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+/**
+ * A background thread that executes file writes in the order they are queued,
+ * so that an output object can return to the solve as soon as the data it
+ * needs has been copied.
+ *
+ * The file libraries (ExodusII and NetCDF) are not thread safe, so a single
+ * thread is shared by every output object in the process, see shared().  The
+ * tasks must not touch the mesh, the systems or anything else that the solve
+ * may modify; they should only use data they own.
+ */
+class OutputWriterThread
+{
+public:
+  OutputWriterThread();
+
+  /// Completes all of the queued tasks and stops the thread
+  ~OutputWriterThread();
+
+  /// The thread shared by all of the asynchronous outputs, it is started by the first call
+  static OutputWriterThread & shared();
+
+  /// True once the shared thread has been started
+  static bool sharedStarted();
+
+  /// Add a task to the end of the queue
+  void enqueue(const std::function<void()> & task);
+
+  /**
+   * Block until all of the queued tasks have completed.  If a task failed
+   * the error is reported here, on the calling thread.
+   */
+  void flush();
+
+  /// The number of tasks that have been queued and not completed
+  std::size_t pending();
+
+protected:
+  /// The body of the writer thread
+  void run();
+
+  /// Protects all of the data below
+  std::mutex _mutex;
+
+  /// Signaled when a task is queued or the thread is asked to stop
+  std::condition_variable _task_queued;
+
+  /// Signaled when the queue becomes empty
+  std::condition_variable _queue_empty;
+
+  /// The tasks waiting to be executed, the front task may be running
+  std::deque<std::function<void()> > _tasks;
+
+  /// Set by the destructor to stop the thread once the queue is empty
+  bool _stop;
+
+  /// The message of the first task that failed
+  std::string _error;
+
+  /// The writer thread
+  std::thread _thread;
+};
+
+#endif
+
+namespace Moose
+{
+/**
+ * Complete the writes queued by the asynchronous outputs, if any.  The ExodusII and NetCDF
+ * libraries are not thread safe, so this is called before they are used on the calling thread.
+ */
+void flushOutputWriter();
+}
+
+#endif // OUTPUTWRITERTHREAD_H
@@ -16,6 +16,7 @@
 #define PARALLELUNIQUEID_H
 
 #include "MooseTypes.h"  // included for namespace usage and THREAD_ID
+#include "ThreadAffinity.h"
 
 #include "libmesh/libmesh_common.h"
 #include "libmesh/threads.h"
@@ -54,6 +55,10 @@ public:
     // There is no thread model active, so we're always on thread 0.
     id = 0;
 #endif
+
+    // With --pin-threads the thread moves to the processor of its id, where the data of the id lives
+    if (Moose::thread_affinity.enabled())
+      Moose::thread_affinity.pin(id);
   }
 
   ~ParallelUniqueId()
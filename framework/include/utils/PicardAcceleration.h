@@ -0,0 +1,103 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef PICARDACCELERATION_H
+#define PICARDACCELERATION_H
+
+// MOOSE includes
+#include "MooseTypes.h"
+
+// libMesh includes
+#include "libmesh/parallel.h"
+
+// C++ includes
+#include <deque>
+#include <vector>
+
+/**
+ * PicardAcceleration computes the next iterate x_{k+1} of a fixed point
+ * iteration x = G(x) from the current iterate x_k and the value G(x_k).
+ *
+ * The vectors are distributed: each processor supplies its own part and the
+ * inner products are summed over the communicator.  Values that are the same
+ * on every processor (postprocessors) should only be supplied by one of them.
+ *
+ * Available methods:
+ *  - NONE: x_{k+1} = G(x_k), plain Picard iteration
+ *  - CONSTANT: x_{k+1} = x_k + w (G(x_k) - x_k)
+ *  - AITKEN: constant relaxation with w updated every iteration by Aitken's delta-squared rule
+ *  - ANDERSON: Anderson mixing using the residuals of the last "depth" iterations
+ */
+class PicardAcceleration
+{
+public:
+  enum Method
+  {
+    NONE,
+    CONSTANT,
+    AITKEN,
+    ANDERSON
+  };
+
+  /**
+   * @param comm The communicator the vectors are distributed over
+   * @param method The acceleration method
+   * @param relaxation The relaxation factor (the initial one for AITKEN)
+   * @param depth The number of previous iterations used by ANDERSON
+   */
+  PicardAcceleration(const Parallel::Communicator & comm, Method method, Real relaxation, unsigned int depth);
+
+  /// Forget the previous iterations, called at the start of every time step
+  void reset();
+
+  /**
+   * Replace x (the input of the last iteration) with the input of the next iteration.
+   * @param x On input x_k, on output x_{k+1}
+   * @param g G(x_k), same size as x
+   */
+  void update(std::vector<Real> & x, const std::vector<Real> & g);
+
+  /// The relaxation factor used by the last update
+  Real relaxation() const { return _current_relaxation; }
+
+protected:
+  /// Inner product summed over all processors
+  Real dot(const std::vector<Real> & a, const std::vector<Real> & b) const;
+
+  void updateAitken(std::vector<Real> & x, const std::vector<Real> & g, const std::vector<Real> & f);
+  void updateAnderson(std::vector<Real> & x, const std::vector<Real> & g, const std::vector<Real> & f);
+
+  const Parallel::Communicator & _communicator;
+
+  const Method _method;
+
+  /// The relaxation factor supplied by the user
+  const Real _relaxation;
+
+  /// The number of previous iterations used by ANDERSON
+  const unsigned int _depth;
+
+  /// The relaxation factor used by the last update
+  Real _current_relaxation;
+
+  /// The residual G(x_{k-1}) - x_{k-1} and G(x_{k-1}) of the previous iteration
+  std::vector<Real> _f_old;
+  std::vector<Real> _g_old;
+
+  /// Differences of consecutive residuals and G values, newest last (ANDERSON)
+  std::deque<std::vector<Real> > _df;
+  std::deque<std::vector<Real> > _dg;
+};
+
+#endif // PICARDACCELERATION_H
@@ -49,6 +49,12 @@ public:
    */
   unsigned int getSeed(dof_id_type id);
 
+  /**
+   * The number of times the counter-based draws have been reset, incremented by updateSeeds()
+   * whenever the per entity streams would have been reseeded or restored.
+   */
+  unsigned int resetCount() const { return _reset_count; }
+
 private:
   void updateGenerators();
 
@@ -62,6 +68,10 @@ private:
   bool _is_nodal;
   ExecFlagType _reset_on;
 
+  /// Whether the RandomInterface uses the counter-based generator, which needs no per entity state
+  bool _counter_based;
+  unsigned int _reset_count;
+
   unsigned int _master_seed;
   unsigned int _current_master_seed;
   unsigned int _new_seed;
@@ -46,6 +46,8 @@ public:
 
   /**
    * Returns the next random number (long) from the generator tied to this object (elem/node).
+   * With "counter_based_random" the number only depends on the seed, the time step, the
+   * entity id and the number of draws made on this entity since the last reset.
    */
   unsigned long getRandomLong() const;
 
@@ -61,16 +63,32 @@ public:
    */
   unsigned int getSeed(unsigned int id);
 
+  /**
+   * Returns a random number in the range [0, 1) that is a pure function of the master seed,
+   * the current time step, the id and the index, independent of the partitioning and of
+   * the order of the calls.  This needs no call to setRandomResetFrequency().
+   * @param id - the id of the entity, e.g. the current element
+   * @param index - the index of the number for this entity, e.g. the qp
+   */
+  Real getCounterRandomReal(dof_id_type id, unsigned int index) const;
+
   /**************************************************
    *                Data Accessors                  *
    **************************************************/
   unsigned int getMasterSeed() const { return _master_seed; }
   bool isNodal() const { return _is_nodal; }
+  bool isCounterBased() const { return _counter_based; }
   ExecFlagType getResetOnTime() const { return _reset_on; }
 
   void setRandomDataPointer(RandomData *random_data);
 
 private:
+  /// The id of the current elem/node
+  dof_id_type currentId() const;
+
+  /// The index of the next counter-based draw for the supplied entity
+  unsigned int nextDrawIndex(dof_id_type id) const;
+
   RandomData *_random_data;
   mutable MooseRandom *_generator;
 
@@ -81,6 +99,15 @@ private:
   bool _is_nodal;
   ExecFlagType _reset_on;
 
+  /// Whether the numbers come from the counter-based generator instead of the per entity streams
+  const bool _counter_based;
+
+  ///@{ The entity, the reset pass of the RandomData and the draw index of the last counter-based draw
+  mutable dof_id_type _draw_id;
+  mutable unsigned int _draw_pass;
+  mutable unsigned int _draw_index;
+  ///@}
+
   const Node * & _curr_node;
   const Elem * & _curr_element;
 
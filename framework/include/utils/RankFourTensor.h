@@ -305,6 +305,13 @@ void dataStore(std::ostream &, RankFourTensor &, void *);
 template<>
 void dataLoad(std::istream &, RankFourTensor &, void *);
 
+/// Stored as its Reals, so arrays of RankFourTensors are stored as one block
+template<>
+struct DataIOBlockCopyable<RankFourTensor>
+{
+  static const bool value = sizeof(RankFourTensor) == LIBMESH_DIM * LIBMESH_DIM * LIBMESH_DIM * LIBMESH_DIM * sizeof(Real);
+};
+
 inline RankFourTensor operator*(Real a, const RankFourTensor & b) { return b * a; }
 
 template<class T>
@@ -330,6 +330,24 @@ public:
    */
   void symmetricEigenvaluesEigenvectors(std::vector<Real> & eigvals, RankTwoTensor & eigvecs) const;
 
+  /**
+   * computes eigenvalues and eigenvectors of the symmetric part of the tensor with cyclic
+   * Jacobi rotations and places them in ascending order in eigvals.  eigvecs is a matrix
+   * with the first column being the first eigenvector, the second column being the second, etc.
+   * Unlike symmetricEigenvaluesEigenvectors() this does not call LAPACK and does not allocate.
+   */
+  void symmetricEigenvaluesEigenvectorsJacobi(Real eigvals[LIBMESH_DIM], RankTwoTensor & eigvecs) const;
+
+  /**
+   * Calls symmetricEigenvaluesEigenvectorsJacobi() for the first n tensors of a container
+   * (for instance all the quadrature points of a MaterialProperty<RankTwoTensor>).
+   * eigvals[LIBMESH_DIM*qp + i] is the i-th eigenvalue of tensors[qp] and eigvecs[qp]
+   * holds its eigenvectors.  The output vectors are only resized, so their storage is
+   * reused between calls.
+   */
+  template<typename T>
+  static void symmetricEigenvaluesEigenvectorsBatch(const T & tensors, unsigned int n, std::vector<Real> & eigvals, std::vector<RankTwoTensor> & eigvecs);
+
   /**
    * computes eigenvalues, and their symmetric derivatives wrt vals,
    * assuming tens is symmetric
@@ -415,4 +433,22 @@ void dataStore(std::ostream & stream, RankTwoTensor &, void *);
 template<>
 void dataLoad(std::istream & stream, RankTwoTensor &, void *);
 
+/// Stored as its Reals, so arrays of RankTwoTensors are stored as one block
+template<>
+struct DataIOBlockCopyable<RankTwoTensor>
+{
+  static const bool value = sizeof(RankTwoTensor) == LIBMESH_DIM * LIBMESH_DIM * sizeof(Real);
+};
+
+template<typename T>
+void
+RankTwoTensor::symmetricEigenvaluesEigenvectorsBatch(const T & tensors, unsigned int n, std::vector<Real> & eigvals, std::vector<RankTwoTensor> & eigvecs)
+{
+  eigvals.resize(N * n);
+  eigvecs.resize(n);
+
+  for (unsigned int qp = 0; qp < n; ++qp)
+    tensors[qp].symmetricEigenvaluesEigenvectorsJacobi(&eigvals[N * qp], eigvecs[qp]);
+}
+
 #endif //RANKTWOTENSOR_H
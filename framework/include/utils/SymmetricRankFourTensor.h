@@ -0,0 +1,138 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef SYMMETRICRANKFOURTENSOR_H
+#define SYMMETRICRANKFOURTENSOR_H
+
+// MOOSE includes
+#include "Moose.h"
+#include "DerivativeMaterialInterface.h"
+
+// libMesh includes
+#include "libmesh/libmesh.h"
+
+#include <utility>
+
+class RankTwoTensor;
+class RankFourTensor;
+class SymmetricRankFourTensor;
+
+/**
+ * Helper function template specialization to set an object to zero.
+ * Needed by DerivativeMaterialInterface
+ */
+template<>
+void mooseSetToZero<SymmetricRankFourTensor>(SymmetricRankFourTensor & v);
+
+/**
+ * SymmetricRankFourTensor holds a fourth order tensor C with both minor symmetries
+ * (C_ijkl = C_jikl = C_ijlk) and major symmetry (C_ijkl = C_klij), such as an elasticity tensor.
+ *
+ * The tensor is stored as the upper triangle of its 6x6 Mandel matrix M, i.e. 21 values
+ * instead of the 81 entries of a RankFourTensor. The Mandel index pairs are ordered
+ * 11, 22, 33, 23, 13, 12 and the shear rows and columns carry a factor of sqrt(2), so that
+ * for symmetric e the contraction C_ijkl*e_kl becomes the 6x6 matrix vector product M*e.
+ */
+class SymmetricRankFourTensor
+{
+public:
+  /// Number of rows/columns of the Mandel matrix
+  static const unsigned int N = 6;
+
+  /// Number of stored (independent) values
+  static const unsigned int N_VALS = N * (N + 1) / 2;
+
+  /// Default constructor; fills to zero
+  SymmetricRankFourTensor();
+
+  /**
+   * Compress a RankFourTensor. Only C_ijkl with (ij) <= (kl) in Mandel ordering is read,
+   * so the input tensor is assumed to have the minor and major symmetries.
+   */
+  explicit SymmetricRankFourTensor(const RankFourTensor & a);
+
+  /// Expand into a full RankFourTensor
+  RankFourTensor toRankFourTensor() const;
+
+  /// Gets the value for the index specified.  Takes index = 0,1,2
+  Real operator()(unsigned int i, unsigned int j, unsigned int k, unsigned int l) const;
+
+  /// Gets the Mandel matrix entry M_ab.  Takes index = 0,...,5
+  Real mandel(unsigned int a, unsigned int b) const { return _vals[index(a, b)]; }
+
+  /// Sets the Mandel matrix entries M_ab and M_ba.  Takes index = 0,...,5
+  void setMandel(unsigned int a, unsigned int b, Real value) { _vals[index(a, b)] = value; }
+
+  /// Zeros out the tensor.
+  void zero();
+
+  /// Print the Mandel matrix
+  void print(std::ostream & stm = Moose::out) const;
+
+  /// C_ijkl*a_kl (only the symmetric part of a contributes)
+  RankTwoTensor operator* (const RankTwoTensor & a) const;
+
+  /// C_ijkl*a
+  SymmetricRankFourTensor operator* (const Real a) const;
+
+  /// C_ijkl *= a
+  SymmetricRankFourTensor & operator*= (const Real a);
+
+  /// C_ijkl += a_ijkl
+  SymmetricRankFourTensor & operator+= (const SymmetricRankFourTensor & a);
+
+  /// C_ijkl -= a_ijkl
+  SymmetricRankFourTensor & operator-= (const SymmetricRankFourTensor & a);
+
+  /// C_ijkl + a_ijkl
+  SymmetricRankFourTensor operator+ (const SymmetricRankFourTensor & a) const;
+
+  /// C_ijkl - a_ijkl
+  SymmetricRankFourTensor operator- (const SymmetricRankFourTensor & a) const;
+
+  /// sqrt(C_ijkl*C_ijkl)
+  Real L2norm() const;
+
+  /**
+   * Rotate the tensor using
+   * C_ijkl = R_im R_in R_ko R_lp C_mnop
+   */
+  void rotate(const RankTwoTensor & R);
+
+protected:
+  /// Position of M_ab (or M_ba) in _vals
+  static unsigned int index(unsigned int a, unsigned int b)
+  {
+    if (a > b)
+      std::swap(a, b);
+    return a * (2 * N - a + 1) / 2 + b - a;
+  }
+
+  /// Mandel index of the symmetric index pair (i, j)
+  static unsigned int mandelIndex(unsigned int i, unsigned int j)
+  {
+    return i == j ? i : 6 - i - j;
+  }
+
+  /// Upper triangle of the Mandel matrix, stored row by row
+  Real _vals[N_VALS];
+
+  template<class T>
+  friend void dataStore(std::ostream &, T &, void *);
+
+  template<class T>
+  friend void dataLoad(std::istream &, T &, void *);
+};
+
+template<>
+void dataStore(std::ostream &, SymmetricRankFourTensor &, void *);
+
+template<>
+void dataLoad(std::istream &, SymmetricRankFourTensor &, void *);
+
+inline SymmetricRankFourTensor operator*(Real a, const SymmetricRankFourTensor & b) { return b * a; }
+
+#endif //SYMMETRICRANKFOURTENSOR_H
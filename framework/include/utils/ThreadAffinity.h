@@ -0,0 +1,86 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef THREADAFFINITY_H
+#define THREADAFFINITY_H
+
+#include "MooseTypes.h"
+
+// C++ includes
+#include <vector>
+
+/**
+ * ThreadAffinity pins the threads of the threaded loops to processors, so that
+ * the per-thread data (Assembly, MaterialData, MooseVariable) stays in the
+ * memory of the NUMA domain of the thread that uses it.
+ *
+ * The processor is chosen by thread id, not by OS thread: the thread that takes
+ * id tid from ParallelUniqueId is moved to the processor of tid.  Thread tid
+ * gets the tid-th processor this process is allowed to run on (as set by the
+ * MPI launcher, for instance), so the threads of a process are packed on
+ * neighboring processors.  Pinning is enabled with --pin-threads and is only
+ * supported on Linux.
+ */
+class ThreadAffinity
+{
+public:
+  /**
+   * Scoped first-touch helper: moves the calling thread to the processor of a
+   * thread id, so that memory allocated (and initialized) in the meantime is
+   * placed in the NUMA domain of that thread.  The affinity of the calling
+   * thread is restored on destruction.  Does nothing if pinning is disabled.
+   */
+  class FirstTouch
+  {
+  public:
+    FirstTouch();
+    ~FirstTouch();
+
+    /// Move the calling thread to the processor of thread tid
+    void pin(THREAD_ID tid);
+
+  private:
+    /// The processors the calling thread was allowed to run on, empty if pinning is disabled
+    std::vector<int> _saved;
+  };
+
+  ThreadAffinity();
+
+  /// Start pinning the threads; records the processors this process may run on
+  void enable();
+
+  /// True if the threads are pinned
+  bool enabled() const { return _enabled; }
+
+  /// Move the calling thread to the processor of thread tid, if it is not there already
+  void pin(THREAD_ID tid);
+
+  /// The processor of thread tid
+  int processor(THREAD_ID tid) const { return _processors[tid % _processors.size()]; }
+
+protected:
+  /// Whether the threads are pinned
+  bool _enabled;
+
+  /// The processors this process may run on, in increasing order
+  std::vector<int> _processors;
+};
+
+namespace Moose
+{
+/// The thread pinning used by ParallelUniqueId, enabled by the --pin-threads command line option
+extern ThreadAffinity thread_affinity;
+}
+
+#endif // THREADAFFINITY_H
@@ -0,0 +1,126 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef TRACELOG_H
+#define TRACELOG_H
+
+// MOOSE includes
+#include "MooseTypes.h"
+
+// C++ includes
+#include <chrono>
+#include <string>
+#include <vector>
+
+/**
+ * TraceLog keeps a timeline of events, as opposed to the totals kept by
+ * PerfLog, so that load imbalance can be seen over the course of a run.
+ *
+ * Two sources of events are recorded:
+ *  - the Moose::perf_log events pushed and popped through Moose::perfPush()
+ *    and Moose::perfPop() (on the main thread), and
+ *  - optionally, the per-object ObjectPerfLog timers (on every thread).
+ *
+ * Events are kept in memory, per thread, and written in the Chrome trace
+ * event format (https://github.com/catapult-project/catapult, "Trace Event
+ * Format") by the ChromeTrace output.
+ */
+class TraceLog
+{
+public:
+  typedef std::chrono::steady_clock Clock;
+
+  /// A complete (begin and end) event
+  struct Event
+  {
+    std::string name;
+    std::string category;
+
+    /// Time of the start of the event since the start of the trace, in microseconds
+    Real start;
+
+    /// Duration in microseconds
+    Real duration;
+  };
+
+  TraceLog();
+
+  /**
+   * Start recording; sizes the per-thread tables, so call this after libMesh is initialized.
+   * The start of the trace is set by the first call.
+   * @param object_events Also record the per-object ObjectPerfLog timers
+   */
+  void enable(bool object_events);
+
+  /// True if events are being recorded
+  bool enabled() const { return _enabled; }
+
+  /// True if the per-object events are being recorded
+  bool objectEvents() const { return _enabled && _object_events; }
+
+  /// Begin an event on the main thread; events must be nested
+  void push(const std::string & name, const std::string & category);
+
+  /// End the event most recently begun by push()
+  void pop(const std::string & name, const std::string & category);
+
+  /// Record a complete event on thread tid
+  void addEvent(THREAD_ID tid, const std::string & name, const std::string & category,
+                const Clock::time_point & start, const Clock::time_point & end);
+
+  /**
+   * Write the recorded events as comma separated Chrome trace event objects
+   * (without the enclosing array), with "pid" set to the supplied rank and "tid" to the thread.
+   * @return The number of events written
+   */
+  std::size_t writeEvents(std::ostream & os, processor_id_type rank) const;
+
+  /// Remove all recorded events
+  void clear();
+
+protected:
+  /// Time since the start of the trace in microseconds
+  Real microseconds(const Clock::time_point & time) const;
+
+  /// An event that has been pushed but not popped
+  struct OpenEvent
+  {
+    std::string name;
+    std::string category;
+    Clock::time_point start;
+  };
+
+  /// Whether events are being recorded
+  bool _enabled;
+
+  /// Whether the per-object events are being recorded
+  bool _object_events;
+
+  /// The start of the trace
+  Clock::time_point _epoch;
+
+  /// Events pushed on the main thread that have not been popped yet
+  std::vector<OpenEvent> _open_events;
+
+  /// The recorded events, per thread
+  std::vector<std::vector<Event> > _events;
+};
+
+namespace Moose
+{
+/// The timeline written by the ChromeTrace output
+extern TraceLog trace_log;
+}
+
+#endif // TRACELOG_H
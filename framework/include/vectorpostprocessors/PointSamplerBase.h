@@ -19,6 +19,7 @@
 #include "GeneralVectorPostprocessor.h"
 #include "CoupleableMooseVariableDependencyIntermediateInterface.h"
 #include "SamplerBase.h"
+#include "MeshChangedInterface.h"
 
 // Forward Declarations
 class PointSamplerBase;
@@ -29,6 +30,7 @@ InputParameters validParams<PointSamplerBase>();
 class PointSamplerBase :
   public GeneralVectorPostprocessor,
   public CoupleableMooseVariableDependencyIntermediateInterface,
+  public MeshChangedInterface,
   protected SamplerBase
 {
 public:
@@ -40,6 +42,11 @@ public:
   virtual void execute();
   virtual void finalize();
 
+  /**
+   * The elements containing the points are found again after the mesh changes
+   */
+  virtual void meshChanged() override;
+
 protected:
   /**
    * Find the local element that contains the point.  This will attempt to use a cached element to speed things up.
@@ -49,6 +56,11 @@ protected:
    */
   const Elem * getLocalElemContainingPoint(const Point & p);
 
+  /**
+   * Find the local elements containing _points and group the points by element
+   */
+  void locatePoints();
+
   /// The Mesh we're using
   MooseMesh & _mesh;
 
@@ -67,6 +79,18 @@ protected:
   unsigned int _qp;
 
   std::unique_ptr<PointLocatorBase> _pl;
+
+  /// Whether the points have to be located again because the mesh changed
+  bool _locate_points;
+
+  /// The points the elements were found for
+  std::vector<Point> _located_points;
+
+  /// The local elements that contain points
+  std::vector<const Elem *> _point_elems;
+
+  /// The indices in _points of the points in each of _point_elems
+  std::vector<std::vector<unsigned int> > _elem_point_indices;
 };
 
 #endif
@@ -16,6 +16,7 @@
 #define SPHERICALAVERAGE_H
 
 #include "ElementVectorPostprocessor.h"
+#include "BinnedReduction.h"
 
 class SphericalAverage;
 
@@ -64,11 +65,11 @@ protected:
   /// value mid point of the bin
   VectorPostprocessorValue & _bin_center;
 
-  /// sample count per bin
-  std::vector<unsigned int> _counts;
-
   /// aggregated global average vectors
   std::vector<VectorPostprocessorValue *> _average;
+
+  /// the sums of the values (the first _nvals quantities) and the sample count (the last one) per bin
+  BinnedReduction _bins;
 };
 
 #endif //SPHERICALAVERAGE_H
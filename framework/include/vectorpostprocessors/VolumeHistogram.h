@@ -16,6 +16,7 @@
 #define VOLUMEHISTOGRAM_H
 
 #include "ElementVectorPostprocessor.h"
+#include "BinnedReduction.h"
 
 class VolumeHistogram;
 
@@ -64,6 +65,9 @@ protected:
 
   /// aggregated volume for the given bin
   VectorPostprocessorValue & _volume;
+
+  /// the volumes accumulated by this thread
+  BinnedReduction _bins;
 };
 
 #endif //VOLUMEHISTOGRAM_H
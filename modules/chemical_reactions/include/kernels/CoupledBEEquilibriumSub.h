@@ -8,6 +8,7 @@
 #define COUPLEDBEEQUILIBRIUMSUB_H
 
 #include "Kernel.h"
+#include "DerivativeMaterialInterface.h"
 
 //Forward Declarations
 class CoupledBEEquilibriumSub;
@@ -19,8 +20,11 @@ InputParameters validParams<CoupledBEEquilibriumSub>();
  * Define the Kernel for a CoupledBEEquilibriumSub operator that looks like:
  *
  * delta (weight * 10^log_k * u^sto_u * v^sto_v) / delta t.
+ *
+ * If equilibrium_species is given the concentration 10^log_k * u^sto_u * v^sto_v
+ * and its derivatives are provided by an EquilibriumSpeciesMaterial.
  */
-class CoupledBEEquilibriumSub : public Kernel
+class CoupledBEEquilibriumSub : public DerivativeMaterialInterface<Kernel>
 {
 public:
   CoupledBEEquilibriumSub(const InputParameters & parameters);
@@ -56,6 +60,16 @@ private:
 
   /// The old values of the primary species concentration.
   const VariableValue & _u_old;
+
+  /// Whether the equilibrium species concentration is provided by an EquilibriumSpeciesMaterial
+  const bool _use_eq_material;
+
+  /// Equilibrium species concentration and its old value from the EquilibriumSpeciesMaterial
+  const MaterialProperty<Real> * _eq_conc;
+  const MaterialProperty<Real> * _eq_conc_old;
+
+  /// Derivatives of the equilibrium species concentration wrt u (index 0) and the coupled species
+  std::vector<const MaterialProperty<Real> *> _deq_conc;
 };
 
 #endif //COUPLEDBEEQUILIBRIUMSUB_H
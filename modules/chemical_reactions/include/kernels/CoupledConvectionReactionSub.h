@@ -5,6 +5,7 @@
 /*             See LICENSE for full restrictions                */
 /****************************************************************/
 #include "Kernel.h"
+#include "DerivativeMaterialInterface.h"
 
 #ifndef COUPLEDCONVECTIONREACTIONSUB_H
 #define COUPLEDCONVECTIONREACTIONSUB_H
@@ -22,7 +23,7 @@ InputParameters validParams<CoupledConvectionReactionSub>();
  *
  * This first line is defining the name and inheriting from Kernel.
  */
-class CoupledConvectionReactionSub : public Kernel
+class CoupledConvectionReactionSub : public DerivativeMaterialInterface<Kernel>
 {
 public:
   CoupledConvectionReactionSub(const InputParameters & parameters);
@@ -58,6 +59,22 @@ private:
 
   /// Coupled gradients of primary species concentrations.
   std::vector<const VariableGradient *> _grad_vals;
+
+  /**
+   * Derivative of the gradient of the equilibrium species concentration wrt
+   * the m-th primary species (u for m = 0, otherwise v[m - 1]) in the direction _phi[_j]
+   */
+  RealGradient gradEqConcJacobian(unsigned int m);
+
+  /// Whether the equilibrium species concentration is provided by an EquilibriumSpeciesMaterial
+  const bool _use_eq_material;
+
+  /// Gradient of the equilibrium species concentration from the EquilibriumSpeciesMaterial
+  const MaterialProperty<RealGradient> * _grad_eq_conc;
+
+  /// First and second derivatives of the equilibrium species concentration wrt u (index 0) and the coupled species
+  std::vector<const MaterialProperty<Real> *> _deq_conc;
+  std::vector<std::vector<const MaterialProperty<Real> *> > _d2eq_conc;
 };
 
 #endif //COUPLEDCONVECTIONREACTIONSUB_H
@@ -8,6 +8,7 @@
 #define COUPLEDDIFFUSIONREACTIONSUB_H
 
 #include "Kernel.h"
+#include "DerivativeMaterialInterface.h"
 
 //Forward Declarations
 class CoupledDiffusionReactionSub;
@@ -19,7 +20,7 @@ InputParameters validParams<CoupledDiffusionReactionSub>();
  * Define the Kernel for a CoupledBEEquilibriumSub operator that looks like:
  * grad (diff * grad (weight * 10^log_k * u^sto_u * v^sto_v)).
  */
-class CoupledDiffusionReactionSub : public Kernel
+class CoupledDiffusionReactionSub : public DerivativeMaterialInterface<Kernel>
 {
 public:
   CoupledDiffusionReactionSub(const InputParameters & parameters);
@@ -52,6 +53,22 @@ private:
 
   /// Coupled gradients of primary species concentrations.
   std::vector<const VariableGradient *> _grad_vals;
+
+  /**
+   * Derivative of the gradient of the equilibrium species concentration wrt
+   * the m-th primary species (u for m = 0, otherwise v[m - 1]) in the direction _phi[_j]
+   */
+  RealGradient gradEqConcJacobian(unsigned int m);
+
+  /// Whether the equilibrium species concentration is provided by an EquilibriumSpeciesMaterial
+  const bool _use_eq_material;
+
+  /// Gradient of the equilibrium species concentration from the EquilibriumSpeciesMaterial
+  const MaterialProperty<RealGradient> * _grad_eq_conc;
+
+  /// First and second derivatives of the equilibrium species concentration wrt u (index 0) and the coupled species
+  std::vector<const MaterialProperty<Real> *> _deq_conc;
+  std::vector<std::vector<const MaterialProperty<Real> *> > _d2eq_conc;
 };
 
 #endif //COUPLEDDIFFUSIONREACTIONSUB_H
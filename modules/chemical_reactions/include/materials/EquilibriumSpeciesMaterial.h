@@ -0,0 +1,70 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef EQUILIBRIUMSPECIESMATERIAL_H
+#define EQUILIBRIUMSPECIESMATERIAL_H
+
+#include "DerivativeMaterialInterface.h"
+#include "Material.h"
+
+//Forward Declarations
+class EquilibriumSpeciesMaterial;
+
+template<>
+InputParameters validParams<EquilibriumSpeciesMaterial>();
+
+/**
+ * Computes the concentration of an equilibrium (secondary) species from the
+ * mass-action law
+ *
+ * c = 10^log_k * prod_i (primary_species_i)^sto_i
+ *
+ * along with its old value, its gradient and its first and second derivatives
+ * with respect to the primary species.  The equilibrium kernels of every primary
+ * species in the reaction (CoupledBEEquilibriumSub, CoupledDiffusionReactionSub
+ * and CoupledConvectionReactionSub with equilibrium_species set) use these,
+ * so the mass-action products are evaluated once per quadpoint.
+ */
+class EquilibriumSpeciesMaterial : public DerivativeMaterialInterface<Material>
+{
+public:
+  EquilibriumSpeciesMaterial(const InputParameters & parameters);
+
+protected:
+  virtual void computeQpProperties();
+
+  /// Equilibrium constant 10^log_k
+  const Real _eq_const;
+
+  /// Number of primary species in the reaction
+  const unsigned int _num_primary;
+
+  /// Stoichiometric coefficients of the primary species
+  const std::vector<Real> _sto;
+
+  /// Primary species concentrations and their old values and gradients
+  std::vector<const VariableValue *> _vals;
+  std::vector<const VariableValue *> _vals_old;
+  std::vector<const VariableGradient *> _grad_vals;
+
+  /// Concentration of the equilibrium species, its old value and its gradient
+  MaterialProperty<Real> & _conc;
+  MaterialProperty<Real> & _conc_old;
+  MaterialProperty<RealGradient> & _grad_conc;
+
+  /// d(conc)/d(primary_i)
+  std::vector<MaterialProperty<Real> *> _dconc;
+
+  /// d^2(conc)/d(primary_i)/d(primary_j), only j >= i are declared
+  std::vector<std::vector<MaterialProperty<Real> *> > _d2conc;
+
+  /// Per-species powers x^sto, sto*x^(sto-1) and sto*(sto-1)*x^(sto-2)
+  std::vector<Real> _pow0;
+  std::vector<Real> _pow1;
+  std::vector<Real> _pow2;
+};
+
+#endif //EQUILIBRIUMSPECIESMATERIAL_H
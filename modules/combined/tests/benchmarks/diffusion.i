@@ -0,0 +1,87 @@
+# Scalability benchmark run by scripts/benchmarks.py: transient diffusion on a
+# generated cube, the mesh is sized with Mesh/nx, ny and nz
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 20
+  ny = 20
+  nz = 20
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+  [./time]
+    type = TimeDerivative
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Postprocessors]
+  [./residual_time]
+    type = PerformanceData
+    event = 'compute_residual()'
+    column = total_time_with_sub
+  [../]
+  [./jacobian_time]
+    type = PerformanceData
+    event = 'compute_jacobian()'
+    column = total_time_with_sub
+  [../]
+  [./solve_time]
+    type = PerformanceData
+    event = 'solve()'
+    column = total_time_with_sub
+  [../]
+  [./output_time]
+    type = PerformanceData
+    category = Output
+    event = 'outputStep()'
+    column = total_time_with_sub
+  [../]
+  [./peak_memory]
+    type = MemoryUsage
+    value_type = peak
+  [../]
+  [./n_elems]
+    type = NumElems
+  [../]
+  [./n_dofs]
+    type = NumDOFs
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 3
+  dt = 0.1
+  solve_type = NEWTON
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,126 @@
+# Scalability benchmark run by scripts/benchmarks.py: polycrystal grain growth
+# with the GrainTracker remapping the order parameters, the mesh is sized with
+# Mesh/nx and ny
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 50
+  ny = 50
+  xmax = 1000
+  ymax = 1000
+  elem_type = QUAD4
+[]
+
+[GlobalParams]
+  op_num = 8
+  var_name_base = gr
+[]
+
+[Variables]
+  [./PolycrystalVariables]
+  [../]
+[]
+
+[ICs]
+  [./PolycrystalICs]
+    [./PolycrystalVoronoiIC]
+      rand_seed = 1
+      grain_num = 40
+      advanced_op_assignment = true
+    [../]
+  [../]
+[]
+
+[AuxVariables]
+  [./bnds]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+[]
+
+[Kernels]
+  [./PolycrystalKernel]
+  [../]
+[]
+
+[AuxKernels]
+  [./BndsCalc]
+    type = BndsCalcAux
+    variable = bnds
+  [../]
+[]
+
+[BCs]
+  [./Periodic]
+    [./all]
+      auto_direction = 'x y'
+    [../]
+  [../]
+[]
+
+[Materials]
+  [./CuGrGr]
+    type = GBEvolution
+    T = 500 # K
+    wGB = 100 # nm
+    GBmob0 = 2.5e-6
+    Q = 0.23
+    GBenergy = 0.708
+    molar_volume = 7.11e-6
+  [../]
+[]
+
+[Postprocessors]
+  [./grain_tracker]
+    type = GrainTracker
+    threshold = 0.5
+    connecting_threshold = 0.5
+    remap_grains = true
+  [../]
+  [./residual_time]
+    type = PerformanceData
+    event = 'compute_residual()'
+    column = total_time_with_sub
+  [../]
+  [./jacobian_time]
+    type = PerformanceData
+    event = 'compute_jacobian()'
+    column = total_time_with_sub
+  [../]
+  [./solve_time]
+    type = PerformanceData
+    event = 'solve()'
+    column = total_time_with_sub
+  [../]
+  [./output_time]
+    type = PerformanceData
+    category = Output
+    event = 'outputStep()'
+    column = total_time_with_sub
+  [../]
+  [./peak_memory]
+    type = MemoryUsage
+    value_type = peak
+  [../]
+  [./n_elems]
+    type = NumElems
+  [../]
+  [./n_dofs]
+    type = NumDOFs
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 3
+  dt = 100.0
+  solve_type = PJFNK
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+  l_tol = 1e-4
+  nl_rel_tol = 1e-9
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,137 @@
+# Scalability benchmark run by scripts/benchmarks.py: a diffusion problem that
+# exchanges its solution with a diffusion sub-app every time step; the meshes of
+# the master and of the sub-app are sized with Mesh/nx, ny and nz
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 10
+  ny = 10
+  nz = 10
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./from_sub]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+  [./time]
+    type = TimeDerivative
+    variable = u
+  [../]
+  [./source]
+    type = CoupledForce
+    variable = u
+    v = from_sub
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[MultiApps]
+  [./sub]
+    type = TransientMultiApp
+    app_type = ModulesApp
+    execute_on = timestep_end
+    positions = '0 0 0'
+    input_files = multiapp_sub.i
+  [../]
+[]
+
+[Transfers]
+  [./to_sub]
+    type = MultiAppMeshFunctionTransfer
+    direction = to_multiapp
+    multi_app = sub
+    source_variable = u
+    variable = from_master
+  [../]
+  [./from_sub]
+    type = MultiAppNearestNodeTransfer
+    direction = from_multiapp
+    multi_app = sub
+    source_variable = v
+    variable = from_sub
+  [../]
+[]
+
+[Postprocessors]
+  [./to_sub_time]
+    type = PerformanceData
+    category = Transfers
+    event = to_sub
+    column = total_time
+  [../]
+  [./from_sub_time]
+    type = PerformanceData
+    category = Transfers
+    event = from_sub
+    column = total_time
+  [../]
+  [./residual_time]
+    type = PerformanceData
+    event = 'compute_residual()'
+    column = total_time_with_sub
+  [../]
+  [./jacobian_time]
+    type = PerformanceData
+    event = 'compute_jacobian()'
+    column = total_time_with_sub
+  [../]
+  [./solve_time]
+    type = PerformanceData
+    event = 'solve()'
+    column = total_time_with_sub
+  [../]
+  [./output_time]
+    type = PerformanceData
+    category = Output
+    event = 'outputStep()'
+    column = total_time_with_sub
+  [../]
+  [./peak_memory]
+    type = MemoryUsage
+    value_type = peak
+  [../]
+  [./n_elems]
+    type = NumElems
+  [../]
+  [./n_dofs]
+    type = NumDOFs
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 3
+  dt = 0.1
+  solve_type = NEWTON
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+  csv = true
+[]
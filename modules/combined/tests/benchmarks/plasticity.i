@@ -0,0 +1,138 @@
+# Scalability benchmark run by scripts/benchmarks.py: finite strain J2 plasticity
+# (stateful material properties) in a cube pulled in z, the mesh is sized with
+# Mesh/nx, ny and nz
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 10
+  ny = 10
+  nz = 10
+[]
+
+[GlobalParams]
+  displacements = 'disp_x disp_y disp_z'
+[]
+
+[Variables]
+  [./disp_x]
+  [../]
+  [./disp_y]
+  [../]
+  [./disp_z]
+  [../]
+[]
+
+[Kernels]
+  [./TensorMechanics]
+  [../]
+[]
+
+[BCs]
+  [./x]
+    type = PresetBC
+    variable = disp_x
+    boundary = left
+    value = 0
+  [../]
+  [./y]
+    type = PresetBC
+    variable = disp_y
+    boundary = bottom
+    value = 0
+  [../]
+  [./z_back]
+    type = PresetBC
+    variable = disp_z
+    boundary = back
+    value = 0
+  [../]
+  [./z_front]
+    type = FunctionPresetBC
+    variable = disp_z
+    boundary = front
+    function = '1E-5*t'
+  [../]
+[]
+
+[UserObjects]
+  [./str]
+    type = TensorMechanicsHardeningConstant
+    value = 2
+  [../]
+  [./j2]
+    type = TensorMechanicsPlasticJ2
+    yield_strength = str
+    yield_function_tolerance = 1E-3
+    internal_constraint_tolerance = 1E-9
+  [../]
+[]
+
+[Materials]
+  [./elasticity_tensor]
+    type = ComputeElasticityTensor
+    fill_method = symmetric_isotropic
+    C_ijkl = '0.5E6 1E6'
+  [../]
+  [./strain]
+    type = ComputeFiniteStrain
+  [../]
+  [./mc]
+    type = ComputeMultiPlasticityStress
+    ep_plastic_tolerance = 1E-9
+    plastic_models = j2
+  [../]
+[]
+
+[Postprocessors]
+  [./residual_time]
+    type = PerformanceData
+    event = 'compute_residual()'
+    column = total_time_with_sub
+  [../]
+  [./jacobian_time]
+    type = PerformanceData
+    event = 'compute_jacobian()'
+    column = total_time_with_sub
+  [../]
+  [./solve_time]
+    type = PerformanceData
+    event = 'solve()'
+    column = total_time_with_sub
+  [../]
+  [./output_time]
+    type = PerformanceData
+    category = Output
+    event = 'outputStep()'
+    column = total_time_with_sub
+  [../]
+  [./peak_memory]
+    type = MemoryUsage
+    value_type = peak
+  [../]
+  [./n_elems]
+    type = NumElems
+  [../]
+  [./n_dofs]
+    type = NumDOFs
+  [../]
+[]
+
+[Preconditioning]
+  [./smp]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 3
+  dt = 1
+  solve_type = NEWTON
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,305 @@
+# Scalability benchmark run by scripts/benchmarks.py: fully coupled thermo-hydro-
+# mechanical PorousFlow problem, hot fluid injected at the left of a poroelastic
+# block, the mesh is sized with Mesh/nx, ny and nz
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 10
+  ny = 10
+  nz = 10
+[]
+
+[GlobalParams]
+  PorousFlowDictator = dictator
+  displacements = 'disp_x disp_y disp_z'
+[]
+
+[Variables]
+  [./disp_x]
+  [../]
+  [./disp_y]
+  [../]
+  [./disp_z]
+  [../]
+  [./pp]
+  [../]
+  [./temp]
+    initial_condition = 1
+  [../]
+[]
+
+[Kernels]
+  [./grad_stress_x]
+    type = StressDivergenceTensors
+    variable = disp_x
+    component = 0
+  [../]
+  [./grad_stress_y]
+    type = StressDivergenceTensors
+    variable = disp_y
+    component = 1
+  [../]
+  [./grad_stress_z]
+    type = StressDivergenceTensors
+    variable = disp_z
+    component = 2
+  [../]
+  [./poro_x]
+    type = PorousFlowEffectiveStressCoupling
+    biot_coefficient = 0.6
+    variable = disp_x
+    component = 0
+  [../]
+  [./poro_y]
+    type = PorousFlowEffectiveStressCoupling
+    biot_coefficient = 0.6
+    variable = disp_y
+    component = 1
+  [../]
+  [./poro_z]
+    type = PorousFlowEffectiveStressCoupling
+    biot_coefficient = 0.6
+    variable = disp_z
+    component = 2
+  [../]
+  [./mass_dot]
+    type = PorousFlowMassTimeDerivative
+    fluid_component = 0
+    variable = pp
+  [../]
+  [./mass_vol_exp]
+    type = PorousFlowMassVolumetricExpansion
+    fluid_component = 0
+    variable = pp
+  [../]
+  [./advection]
+    type = PorousFlowAdvectiveFlux
+    fluid_component = 0
+    variable = pp
+    gravity = '0 0 0'
+  [../]
+  [./energy_dot]
+    type = PorousFlowEnergyTimeDerivative
+    variable = temp
+  [../]
+  [./heat_advection]
+    type = PorousFlowHeatAdvection
+    variable = temp
+    gravity = '0 0 0'
+  [../]
+  [./conduction]
+    type = PorousFlowHeatConduction
+    variable = temp
+  [../]
+[]
+
+[UserObjects]
+  [./dictator]
+    type = PorousFlowDictator
+    porous_flow_vars = 'pp temp disp_x disp_y disp_z'
+    number_fluid_phases = 1
+    number_fluid_components = 1
+  [../]
+[]
+
+[BCs]
+  [./pp_left]
+    type = PresetBC
+    variable = pp
+    boundary = left
+    value = 1
+  [../]
+  [./pp_right]
+    type = PresetBC
+    variable = pp
+    boundary = right
+    value = 0
+  [../]
+  [./temp_left]
+    type = PresetBC
+    variable = temp
+    boundary = left
+    value = 2
+  [../]
+  [./xmin]
+    type = PresetBC
+    variable = disp_x
+    boundary = left
+    value = 0
+  [../]
+  [./ymin]
+    type = PresetBC
+    variable = disp_y
+    boundary = bottom
+    value = 0
+  [../]
+  [./zmin]
+    type = PresetBC
+    variable = disp_z
+    boundary = back
+    value = 0
+  [../]
+[]
+
+[Materials]
+  [./temperature]
+    type = PorousFlowTemperature
+    temperature = temp
+  [../]
+  [./nnn]
+    type = PorousFlowNodeNumber
+    on_initial_only = true
+  [../]
+  [./elasticity_tensor]
+    type = ComputeElasticityTensor
+    C_ijkl = '0.5 0.75'
+    fill_method = symmetric_isotropic
+  [../]
+  [./strain]
+    type = ComputeSmallStrain
+  [../]
+  [./stress]
+    type = ComputeLinearElasticStress
+  [../]
+  [./vol_strain]
+    type = PorousFlowVolumetricStrain
+  [../]
+  [./eff_fluid_pressure]
+    type = PorousFlowEffectiveFluidPressure
+  [../]
+  [./porosity]
+    type = PorousFlowPorosityTHM
+    porosity_zero = 0.2
+    thermal_expansion_coeff = 0.1
+    biot_coefficient = 0.6
+    solid_bulk = 1
+  [../]
+  [./ppss]
+    type = PorousFlow1PhaseP_VG
+    porepressure = pp
+    al = 1
+    m = 0.6
+  [../]
+  [./massfrac]
+    type = PorousFlowMassFraction
+  [../]
+  [./dens0]
+    type = PorousFlowDensityConstBulk
+    density_P0 = 1
+    bulk_modulus = 8
+    phase = 0
+  [../]
+  [./dens_all]
+    type = PorousFlowJoiner
+    include_old = true
+    material_property = PorousFlow_fluid_phase_density
+  [../]
+  [./dens_qp_all]
+    type = PorousFlowJoiner
+    material_property = PorousFlow_fluid_phase_density_qp
+    at_qps = true
+  [../]
+  [./permeability]
+    type = PorousFlowPermeabilityConst
+    permeability = '1 0 0  0 1 0  0 0 1'
+  [../]
+  [./relperm]
+    type = PorousFlowRelativePermeabilityCorey
+    n_j = 2
+    phase = 0
+  [../]
+  [./relperm_all]
+    type = PorousFlowJoiner
+    material_property = PorousFlow_relative_permeability
+  [../]
+  [./visc0]
+    type = PorousFlowViscosityConst
+    viscosity = 1
+    phase = 0
+  [../]
+  [./visc_all]
+    type = PorousFlowJoiner
+    material_property = PorousFlow_viscosity
+  [../]
+  [./rock_heat]
+    type = PorousFlowMatrixInternalEnergy
+    specific_heat_capacity = 1
+    density = 2
+  [../]
+  [./fluid_energy]
+    type = PorousFlowInternalEnergyIdeal
+    specific_heat_capacity = 2
+    phase = 0
+  [../]
+  [./energy_all]
+    type = PorousFlowJoiner
+    include_old = true
+    material_property = PorousFlow_fluid_phase_internal_energy_nodal
+  [../]
+  [./fluid_enthalpy]
+    type = PorousFlowEnthalpy
+    phase = 0
+  [../]
+  [./enthalpy_all]
+    type = PorousFlowJoiner
+    material_property = PorousFlow_fluid_phase_enthalpy_nodal
+  [../]
+  [./thermal_conductivity]
+    type = PorousFlowThermalConductivityIdeal
+    dry_thermal_conductivity = '1 0 0  0 1 0  0 0 1'
+  [../]
+[]
+
+[Postprocessors]
+  [./residual_time]
+    type = PerformanceData
+    event = 'compute_residual()'
+    column = total_time_with_sub
+  [../]
+  [./jacobian_time]
+    type = PerformanceData
+    event = 'compute_jacobian()'
+    column = total_time_with_sub
+  [../]
+  [./solve_time]
+    type = PerformanceData
+    event = 'solve()'
+    column = total_time_with_sub
+  [../]
+  [./output_time]
+    type = PerformanceData
+    category = Output
+    event = 'outputStep()'
+    column = total_time_with_sub
+  [../]
+  [./peak_memory]
+    type = MemoryUsage
+    value_type = peak
+  [../]
+  [./n_elems]
+    type = NumElems
+  [../]
+  [./n_dofs]
+    type = NumDOFs
+  [../]
+[]
+
+[Preconditioning]
+  [./smp]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 3
+  dt = 0.1
+  solve_type = NEWTON
+  petsc_options_iname = '-ksp_type -pc_type -pc_hypre_type'
+  petsc_options_value = 'gmres hypre boomeramg'
+[]
+
+[Outputs]
+  csv = true
+[]
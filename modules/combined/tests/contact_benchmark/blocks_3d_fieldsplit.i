@@ -0,0 +1,229 @@
+# Contact benchmark: two 3D blocks in frictionless kinematic contact, solved
+# with the ContactSplit field split preconditioner.
+#
+# The number of slave nodes is set with Mesh/uniform_refine; the time spent
+# in each phase of the contact calculation is written to the CSV file.  See
+# scripts/contact_benchmark.py, which runs this with increasing refinement.
+
+[GlobalParams]
+  order = FIRST
+  family = LAGRANGE
+  disp_x = disp_x
+  disp_y = disp_y
+  disp_z = disp_z
+[]
+
+[Mesh]
+  file = ../fieldsplit_contact/2blocks3d.e
+  displacements = 'disp_x disp_y disp_z'
+  patch_size = 5
+[]
+
+[Variables]
+  [./disp_x]
+  [../]
+  [./disp_y]
+  [../]
+  [./disp_z]
+  [../]
+[]
+
+[AuxVariables]
+  [./penetration]
+  [../]
+  [./one]
+    [./InitialCondition]
+      type = ConstantIC
+      value = 1
+    [../]
+  [../]
+[]
+
+[Functions]
+  [./horizontal_movement]
+    type = ParsedFunction
+    value = t/10.0
+  [../]
+[]
+
+[SolidMechanics]
+  [./solid]
+    disp_x = disp_x
+    disp_y = disp_y
+    disp_z = disp_z
+  [../]
+[]
+
+[AuxKernels]
+  [./penetration]
+    type = PenetrationAux
+    variable = penetration
+    boundary = 2
+    paired_boundary = 3
+  [../]
+[]
+
+[BCs]
+  [./push_x]
+    type = FunctionPresetBC
+    variable = disp_x
+    boundary = 1
+    function = horizontal_movement
+  [../]
+  [./fix_x]
+    type = DirichletBC
+    variable = disp_x
+    boundary = 4
+    value = 0.0
+  [../]
+  [./fix_y]
+    type = DirichletBC
+    variable = disp_y
+    boundary = '1 4'
+    value = 0.0
+  [../]
+  [./fix_z]
+    type = DirichletBC
+    variable = disp_z
+    boundary = '1 4'
+    value = 0.0
+  [../]
+[]
+
+[Materials]
+  [./left]
+    type = Elastic
+    block = 1
+    poissons_ratio = 0.3
+    youngs_modulus = 1e6
+  [../]
+  [./right]
+    type = Elastic
+    block = 2
+    poissons_ratio = 0.3
+    youngs_modulus = 1e6
+  [../]
+[]
+
+[Contact]
+  [./leftright]
+    slave = 2
+    master = 3
+    model = frictionless
+    penalty = 1e+6
+    normalize_penalty = true
+    formulation = kinematic
+    system = constraint
+    normal_smoothing_distance = 0.1
+  [../]
+[]
+
+[Preconditioning]
+  active = 'FSP'
+
+  [./FSP]
+    type = FSP
+    # It is the starting point of splitting
+    topsplit = 'contact_interior' # 'contact_interior' should match the following block name
+    [./contact_interior]
+      splitting          = 'contact interior'
+      splitting_type     = multiplicative
+    [../]
+    [./interior]
+      type = ContactSplit
+      vars = 'disp_x disp_y disp_z'
+      uncontact_master   = '3'
+      uncontact_slave    = '2'
+      uncontact_displaced = '1'
+      blocks              = '1 2'
+      include_all_contact_nodes = 1
+      petsc_options_iname = '-ksp_type -ksp_max_it -ksp_rtol -ksp_gmres_restart -pc_type -pc_hypre_type -pc_hypre_boomeramg_max_iter -pc_hypre_strong_threshold'
+      petsc_options_value = ' preonly 10 1e-4 201                hypre    boomeramg      1                            0.25'
+    [../]
+    [./contact]
+      type = ContactSplit
+      vars = 'disp_x disp_y disp_z'
+      contact_master   = '3'
+      contact_slave    = '2'
+      contact_displaced = '1'
+      include_all_contact_nodes = 1
+      petsc_options_iname = '-ksp_type -ksp_max_it -pc_type -pc_asm_overlap -sub_pc_type   -pc_factor_levels'
+      petsc_options_value = '  preonly 10 asm  1 lu 0'
+    [../]
+  [../]
+[]
+
+[Problem]
+  error_on_jacobian_nonzero_reallocation = true
+[]
+
+[Postprocessors]
+  [./n_slave_nodes]
+    type = NodalSum
+    variable = one
+    boundary = 2
+    execute_on = initial
+  [../]
+  [./nearest_node_time]
+    type = PerformanceData
+    event = 'NearestNodeLocator::findNodes()'
+    column = total_time
+  [../]
+  [./penetration_time]
+    type = PerformanceData
+    event = 'detectPenetration()'
+    column = total_time
+  [../]
+  [./constraint_residual_time]
+    type = PerformanceData
+    event = 'constraintResiduals()'
+    column = total_time
+  [../]
+  [./constraint_jacobian_time]
+    type = PerformanceData
+    event = 'constraintJacobians()'
+    column = total_time
+  [../]
+  [./residual_time]
+    type = PerformanceData
+    event = 'compute_residual()'
+    column = total_time_with_sub
+  [../]
+  [./jacobian_time]
+    type = PerformanceData
+    event = 'compute_jacobian()'
+    column = total_time_with_sub
+  [../]
+  [./solve_time]
+    type = PerformanceData
+    event = 'solve()'
+    column = total_time_with_sub
+  [../]
+  [./nonlinear_its]
+    type = NumNonlinearIterations
+  [../]
+  [./linear_its]
+    type = NumLinearIterations
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'PJFNK'
+
+  dt = 0.1
+  dtmin = 0.1
+  num_steps = 3
+
+  l_tol = 1e-4
+  l_max_its = 100
+
+  nl_rel_tol = 1e-10
+  nl_abs_tol = 1e-6
+  nl_max_its = 100
+[]
+
+[Outputs]
+  csv = true
+  print_perf_log = true
+[]
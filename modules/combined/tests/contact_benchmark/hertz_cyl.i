@@ -0,0 +1,183 @@
+# Contact benchmark: Hertz contact of a quarter cylinder pressed onto a
+# block, with frictionless kinematic contact enforced by
+# MechanicalContactConstraint.
+#
+# The number of slave nodes is set with Mesh/uniform_refine; the time spent
+# in each phase of the contact calculation is written to the CSV file.  See
+# scripts/contact_benchmark.py, which runs this with increasing refinement.
+
+[Mesh]
+  file = ../contact_verification/hertz_cyl/quart_symm_q4/hertz_cyl_qsym_1deg_q4.e
+  displacements = 'disp_x disp_y'
+[]
+
+[Variables]
+  [./disp_x]
+  [../]
+  [./disp_y]
+  [../]
+[]
+
+[AuxVariables]
+  [./penetration]
+  [../]
+  [./one]
+    [./InitialCondition]
+      type = ConstantIC
+      value = 1
+    [../]
+  [../]
+[]
+
+[Functions]
+  [./disp_ramp_vert]
+    type = PiecewiseLinear
+    x = '0. 1. 2.'
+    y = '0. -0.0020 -0.0020'
+  [../]
+[]
+
+[SolidMechanics]
+  [./solid]
+    disp_x = disp_x
+    disp_y = disp_y
+  [../]
+[]
+
+[AuxKernels]
+  [./penetration]
+    type = PenetrationAux
+    variable = penetration
+    boundary = 4
+    paired_boundary = 3
+  [../]
+[]
+
+[BCs]
+  [./side_x]
+    type = DirichletBC
+    variable = disp_y
+    boundary = '1 3'
+    value = 0.0
+  [../]
+  [./bot_y]
+    type = DirichletBC
+    variable = disp_x
+    boundary = '1 2 3'
+    value = 0.0
+  [../]
+  [./top_y_disp]
+    type = FunctionPresetBC
+    variable = disp_y
+    boundary = 5
+    function = disp_ramp_vert
+  [../]
+[]
+
+[Materials]
+  [./stiffStuff1]
+    type = Elastic
+    block = 1
+    disp_x = disp_x
+    disp_y = disp_y
+    youngs_modulus = 1e10
+    poissons_ratio = 0.0
+  [../]
+  [./stiffStuff2]
+    type = Elastic
+    block = '2 3 4'
+    disp_x = disp_x
+    disp_y = disp_y
+    youngs_modulus = 1e6
+    poissons_ratio = 0.3
+  [../]
+[]
+
+[Contact]
+  [./interface]
+    master = 3
+    slave = 4
+    disp_x = disp_x
+    disp_y = disp_y
+    model = frictionless
+    formulation = kinematic
+    penalty = 1e+9
+    normalize_penalty = true
+    tangential_tolerance = 1e-3
+    system = constraint
+  [../]
+[]
+
+[Postprocessors]
+  [./n_slave_nodes]
+    type = NodalSum
+    variable = one
+    boundary = 4
+    execute_on = initial
+  [../]
+  [./nearest_node_time]
+    type = PerformanceData
+    event = 'NearestNodeLocator::findNodes()'
+    column = total_time
+  [../]
+  [./penetration_time]
+    type = PerformanceData
+    event = 'detectPenetration()'
+    column = total_time
+  [../]
+  [./constraint_residual_time]
+    type = PerformanceData
+    event = 'constraintResiduals()'
+    column = total_time
+  [../]
+  [./constraint_jacobian_time]
+    type = PerformanceData
+    event = 'constraintJacobians()'
+    column = total_time
+  [../]
+  [./residual_time]
+    type = PerformanceData
+    event = 'compute_residual()'
+    column = total_time_with_sub
+  [../]
+  [./jacobian_time]
+    type = PerformanceData
+    event = 'compute_jacobian()'
+    column = total_time_with_sub
+  [../]
+  [./solve_time]
+    type = PerformanceData
+    event = 'solve()'
+    column = total_time_with_sub
+  [../]
+  [./nonlinear_its]
+    type = NumNonlinearIterations
+  [../]
+  [./linear_its]
+    type = NumLinearIterations
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'PJFNK'
+
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+
+  line_search = 'none'
+
+  nl_abs_tol = 1e-6
+  nl_rel_tol = 1e-5
+  nl_max_its = 100
+  l_tol = 1e-3
+  l_max_its = 50
+
+  dt = 0.1
+  num_steps = 5
+[]
+
+[Outputs]
+  csv = true
+  print_perf_log = true
+[]
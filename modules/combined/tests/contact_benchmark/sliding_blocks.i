@@ -0,0 +1,203 @@
+# Contact benchmark: a small 2D block sliding down a larger one, with
+# frictionless kinematic contact enforced by MechanicalContactConstraint.
+#
+# The number of slave nodes is set with Mesh/uniform_refine; the time spent
+# in each phase of the contact calculation is written to the CSV file.  See
+# scripts/contact_benchmark.py, which runs this with increasing refinement.
+
+[Mesh]
+  file = ../sliding_block/sliding/dirac/sliding_elastic_blocks_2d.e
+  displacements = 'disp_x disp_y'
+  patch_size = 80
+[]
+
+[Variables]
+  [./disp_x]
+  [../]
+  [./disp_y]
+  [../]
+[]
+
+[AuxVariables]
+  [./penetration]
+  [../]
+  [./one]
+    [./InitialCondition]
+      type = ConstantIC
+      value = 1
+    [../]
+  [../]
+[]
+
+[Functions]
+  [./vertical_movement]
+    type = ParsedFunction
+    value = -t
+  [../]
+[]
+
+[SolidMechanics]
+  [./solid]
+    disp_x = disp_x
+    disp_y = disp_y
+  [../]
+[]
+
+[AuxKernels]
+  [./penetration]
+    type = PenetrationAux
+    variable = penetration
+    boundary = 3
+    paired_boundary = 2
+  [../]
+[]
+
+[BCs]
+  [./left_x]
+    type = DirichletBC
+    variable = disp_x
+    boundary = 1
+    value = 0.0
+  [../]
+  [./left_y]
+    type = DirichletBC
+    variable = disp_y
+    boundary = 1
+    value = 0.0
+  [../]
+  [./right_x]
+    type = PresetBC
+    variable = disp_x
+    boundary = 4
+    value = -0.02
+  [../]
+  [./right_y]
+    type = FunctionPresetBC
+    variable = disp_y
+    boundary = 4
+    function = vertical_movement
+  [../]
+[]
+
+[Materials]
+  [./left]
+    type = LinearIsotropicMaterial
+    block = 1
+    disp_y = disp_y
+    disp_x = disp_x
+    poissons_ratio = 0.3
+    youngs_modulus = 1e6
+  [../]
+  [./right]
+    type = LinearIsotropicMaterial
+    block = 2
+    disp_y = disp_y
+    disp_x = disp_x
+    poissons_ratio = 0.3
+    youngs_modulus = 1e6
+  [../]
+[]
+
+[Contact]
+  [./leftright]
+    slave = 3
+    master = 2
+    disp_x = disp_x
+    disp_y = disp_y
+    model = frictionless
+    formulation = kinematic
+    penalty = 1e+6
+    normalize_penalty = true
+    system = constraint
+  [../]
+[]
+
+[Postprocessors]
+  [./n_slave_nodes]
+    type = NodalSum
+    variable = one
+    boundary = 3
+    execute_on = initial
+  [../]
+  [./nearest_node_time]
+    type = PerformanceData
+    event = 'NearestNodeLocator::findNodes()'
+    column = total_time
+  [../]
+  [./penetration_time]
+    type = PerformanceData
+    event = 'detectPenetration()'
+    column = total_time
+  [../]
+  [./constraint_residual_time]
+    type = PerformanceData
+    event = 'constraintResiduals()'
+    column = total_time
+  [../]
+  [./constraint_jacobian_time]
+    type = PerformanceData
+    event = 'constraintJacobians()'
+    column = total_time
+  [../]
+  [./residual_time]
+    type = PerformanceData
+    event = 'compute_residual()'
+    column = total_time_with_sub
+  [../]
+  [./jacobian_time]
+    type = PerformanceData
+    event = 'compute_jacobian()'
+    column = total_time_with_sub
+  [../]
+  [./solve_time]
+    type = PerformanceData
+    event = 'solve()'
+    column = total_time_with_sub
+  [../]
+  [./output_time]
+    type = PerformanceData
+    category = Output
+    event = 'outputStep()'
+    column = total_time_with_sub
+  [../]
+  [./peak_memory]
+    type = MemoryUsage
+    value_type = peak
+  [../]
+  [./n_elems]
+    type = NumElems
+  [../]
+  [./n_dofs]
+    type = NumDOFs
+  [../]
+  [./nonlinear_its]
+    type = NumNonlinearIterations
+  [../]
+  [./linear_its]
+    type = NumLinearIterations
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'PJFNK'
+
+  petsc_options_iname = '-pc_type -pc_hypre_type -pc_hypre_boomeramg_max_iter -ksp_gmres_restart'
+  petsc_options_value = 'hypre    boomeramg  4    101'
+
+  line_search = 'none'
+
+  nl_abs_tol = 1e-7
+  nl_rel_tol = 1e-6
+  nl_max_its = 100
+  l_tol = 1e-6
+  l_max_its = 100
+
+  dt = 0.1
+  num_steps = 5
+[]
+
+[Outputs]
+  csv = true
+  print_perf_log = true
+[]
@@ -35,6 +35,7 @@ public:
 
   virtual void initialSetup();
   virtual void timestepSetup();
+  virtual void onTimestepEnd();
 
   virtual bool shouldUpdateSolution();
   virtual bool updateSolution(NumericVector<Number> & vec_solution, NumericVector<Number>& ghosted_solution);
@@ -83,6 +84,13 @@ public:
 
   void updateIncrementalSlip();
 
+  /**
+   * Apply the incremental slip of the slave nodes that were slipping at the end of the
+   * previous step, scaled by the ratio of the time steps, as the first slip estimate of this step.
+   */
+  void applySlipPredictor(NumericVector<Number> & vec_solution,
+                          NumericVector<Number> & ghosted_solution);
+
 protected:
   std::map<std::pair<int, int>, InteractionParams> _interaction_params;
   NonlinearVariableName _disp_x;
@@ -118,6 +126,24 @@ protected:
   Real _inc_slip_norm;
   Real _it_slip_norm;
 
+  /// Whether the slip of the previous step is used as the first slip estimate of a step
+  bool _slip_predictor;
+
+  /// The incremental slip of the local slave nodes that were slipping at the end of the previous step
+  std::map<dof_id_type, RealVectorValue> _predicted_slip;
+
+  /// Slip residual below which a slave node that did not change state is not updated
+  Real _node_slip_tolerance;
+
+  /// The contact state of the local slave nodes at the last slip update of this step
+  std::map<dof_id_type, ContactState> _node_state;
+
+  /// The number of slave nodes skipped by the last slip update because they converged
+  int _num_converged_nodes;
+
+  /// The number of slip iterations over all the steps
+  unsigned int _total_slip_iterations;
+
   /// Convenient typedef for frequently used iterator
   typedef std::map<std::pair<unsigned int, unsigned int>, PenetrationLocator *>::iterator PLIterator;
 };
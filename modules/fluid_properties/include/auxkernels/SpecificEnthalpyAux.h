@@ -25,12 +25,19 @@ public:
   SpecificEnthalpyAux(const InputParameters & parameters);
 
 protected:
+  virtual void precalculateValue();
   virtual Real computeValue();
 
   const VariableValue & _pressure;
   const VariableValue & _temperature;
 
   const SinglePhaseFluidProperties & _fp;
+
+  ///@{ Pressure, temperature and enthalpy at the points of the current element or node
+  std::vector<Real> _p;
+  std::vector<Real> _T;
+  std::vector<Real> _h;
+  ///@}
 };
 
 #endif /* SPECIFICENTHALPYAUX_H */
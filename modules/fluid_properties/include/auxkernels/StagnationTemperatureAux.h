@@ -25,6 +25,7 @@ public:
   StagnationTemperatureAux(const InputParameters & parameters);
 
 protected:
+  virtual void precalculateValue();
   virtual Real computeValue();
 
   const VariableValue & _specific_volume;
@@ -32,6 +33,17 @@ protected:
   const VariableValue & _velocity;
 
   const SinglePhaseFluidProperties & _fp;
+
+  ///@{ Static properties at the points of the current element or node
+  std::vector<Real> _v;
+  std::vector<Real> _e;
+  std::vector<Real> _vel;
+  ///@}
+
+  ///@{ Stagnation properties at the points of the current element or node
+  std::vector<Real> _p0;
+  std::vector<Real> _T0;
+  ///@}
 };
 
 #endif /* STAGNATIONTEMPERATUREAUX_H */
@@ -24,7 +24,9 @@ InputParameters validParams<CO2FluidProperties>();
  *
  * Note: the Span and Wagner EOS uses density and temperature as the primary variables. As
  * a result, density must first be found using iteration, after which the other properties
- * can be calculated directly.
+ * can be calculated directly. The last density found is kept, and is used as the starting
+ * point of Newton's method in the next calculation (warm_start = true), as the pressure and
+ * temperature typically change little between calls.
  */
 class CO2FluidProperties : public SinglePhaseFluidPropertiesPT
 {
@@ -199,6 +201,19 @@ public:
    */
   Real pressureSW(Real density, Real temperature) const;
 
+  /**
+   * Newton's method for the density as a function of pressure and temperature using
+   * the Span and Wagner EOS, starting from the supplied density. Used to warm start
+   * rho(pressure, temperature), which falls back to Brent's method if this fails
+   *
+   * @param pressure CO2 pressure (Pa)
+   * @param temperature CO2 temperature (K)
+   * @param guess initial estimate of the density (kg/m^3)
+   * @param[out] density CO2 density (kg/m^3)
+   * @return true if the iterations converged to a stable single-phase density
+   */
+  bool densityNewton(Real pressure, Real temperature, Real guess, Real & density) const;
+
   /**
    * Helmholtz free energy for CO2
    * From Span and Wagner (reference above)
@@ -351,6 +366,14 @@ public:
   virtual Real beta(Real pressure, Real temperature) const override;
 
 protected:
+  /// Whether the density calculation is started from the previous density
+  const bool _warm_start;
+
+  /// Pressure, temperature and density from the last density calculation
+  mutable Real _last_pressure;
+  mutable Real _last_temperature;
+  mutable Real _last_density;
+
   /**
    * Constants used in the correlations. From
    * Span and Wagner, "A New Equation of State for Carbon Dioxide Covering the Fluid Region
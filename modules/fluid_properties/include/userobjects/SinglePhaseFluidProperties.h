@@ -73,6 +73,17 @@ public:
 
   /// Thermal expansion coefficient
   virtual Real beta(Real p, Real T) const = 0;
+
+  /**
+   * Stagnation pressure and temperature for all (v[i], e[i], vel[i]) points, e.g. all quadrature
+   * points of an element, in one call.  The default implementation goes through pressure(), s(),
+   * p_from_h_s(), rho_e_ps() and temperature() for every point; fluids with a closed form
+   * should override it.
+   */
+  virtual void stagnation_p_T(const std::vector<Real> & v, const std::vector<Real> & e, const std::vector<Real> & vel, std::vector<Real> & p0, std::vector<Real> & T0) const;
+
+  /// Specific enthalpy for all (pressure[i], temperature[i]) points in one call
+  virtual void h_pT(const std::vector<Real> & pressure, const std::vector<Real> & temperature, std::vector<Real> & h) const;
 };
 
 #endif /* SINGLEPHASEFLUIDPROPERTIES_H */
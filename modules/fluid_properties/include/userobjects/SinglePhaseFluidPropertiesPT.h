@@ -25,6 +25,16 @@ public:
   SinglePhaseFluidPropertiesPT(const InputParameters & parameters);
   virtual ~SinglePhaseFluidPropertiesPT();
 
+  /// Values of a property and its derivatives wrt pressure and temperature at a batch of points
+  struct BatchProperty
+  {
+    void resize(std::size_t n) { _value.resize(n); _dp.resize(n); _dT.resize(n); }
+
+    std::vector<Real> _value;
+    std::vector<Real> _dp;
+    std::vector<Real> _dT;
+  };
+
   /// Molar mass (kg/mol)
   virtual Real molarMass() const = 0;
   /// Density from pressure and temperature (kg/m^3)
@@ -62,6 +72,14 @@ public:
   /// Henry's law constant for dissolution in water
   virtual Real henryConstant(Real temperature) const = 0;
 
+  /**
+   * Density, internal energy and enthalpy and their derivatives wrt pressure and temperature for
+   * all (pressure[i], temperature[i]) pairs, e.g. all quadrature points of an element, in one call.
+   * The default implementation calls rho_e_dpT() and h_dpT() for every point; fluids that can share
+   * intermediate results (region detection, common terms) between the properties should override it.
+   */
+  virtual void rho_e_h_dpT(const std::vector<Real> & pressure, const std::vector<Real> & temperature, BatchProperty & rho, BatchProperty & e, BatchProperty & h) const;
+
 protected:
   /// IAPWS formulation of Henry's law constant for dissolution in water
   virtual Real henryConstantIAPWS(Real temperature, Real A, Real B, Real C) const;
@@ -57,6 +57,9 @@ public:
 
   virtual Real c2_from_p_rho(Real pressure, Real rho) const;
 
+  virtual void stagnation_p_T(const std::vector<Real> & v, const std::vector<Real> & e, const std::vector<Real> & vel, std::vector<Real> & p0, std::vector<Real> & T0) const;
+  virtual void h_pT(const std::vector<Real> & pressure, const std::vector<Real> & temperature, std::vector<Real> & h) const;
+
 protected:
   Real _gamma;
   Real _cv;
@@ -0,0 +1,111 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+#ifndef TABULATEDFLUIDPROPERTIES_H
+#define TABULATEDFLUIDPROPERTIES_H
+
+#include "SinglePhaseFluidPropertiesPT.h"
+#include "BicubicInterpolation.h"
+
+class TabulatedFluidProperties;
+
+template<>
+InputParameters validParams<TabulatedFluidProperties>();
+
+/**
+ * Fluid properties interpolated (bicubic) from tables over a rectangular (p, T) range.
+ * The tables are computed from another SinglePhaseFluidPropertiesPT UserObject at startup,
+ * or read from a previously written table file.  Any property that has not been tabulated,
+ * and all properties outside of the tabulated range, are computed by that UserObject.
+ */
+class TabulatedFluidProperties : public SinglePhaseFluidPropertiesPT
+{
+public:
+  TabulatedFluidProperties(const InputParameters & parameters);
+  virtual ~TabulatedFluidProperties();
+
+  virtual Real molarMass() const override;
+  virtual Real rho(Real pressure, Real temperature) const override;
+  virtual void rho_dpT(Real pressure, Real temperature, Real & rho, Real & drho_dp, Real & drho_dT) const override;
+  virtual Real e(Real pressure, Real temperature) const override;
+  virtual void e_dpT(Real pressure, Real temperature, Real & e, Real & de_dp, Real & de_dT) const override;
+  virtual void rho_e_dpT(Real pressure, Real temperature, Real & rho, Real & drho_dp, Real & drho_dT, Real & e, Real & de_dp, Real & de_dT) const override;
+  virtual Real c(Real pressure, Real temperature) const override;
+  virtual Real cp(Real pressure, Real temperature) const override;
+  virtual Real cv(Real pressure, Real temperature) const override;
+  virtual Real mu(Real density, Real temperature) const override;
+  virtual void mu_drhoT(Real density, Real temperature, Real & mu, Real & dmu_drho, Real & dmu_dT) const override;
+  virtual Real k(Real pressure, Real temperature) const override;
+  virtual Real s(Real pressure, Real temperature) const override;
+  virtual Real h(Real p, Real T) const override;
+  virtual void h_dpT(Real pressure, Real temperature, Real & h, Real & dh_dp, Real & dh_dT) const override;
+  virtual Real beta(Real pressure, Real temperature) const override;
+  virtual Real henryConstant(Real temperature) const override;
+
+protected:
+  /// The tabulated properties, in the column order of the table file
+  enum TabulatedProperty
+  {
+    DENSITY = 0,
+    ENTHALPY,
+    INTERNAL_ENERGY,
+    CP,
+    CV,
+    SPEED_OF_SOUND,
+    THERMAL_CONDUCTIVITY,
+    ENTROPY,
+    NUM_PROPERTIES
+  };
+
+  /// Evaluate a property with the wrapped UserObject
+  Real computeProperty(TabulatedProperty property, Real pressure, Real temperature) const;
+
+  /// Fill the tables by evaluating the wrapped UserObject on the grid
+  void generateTables();
+
+  /// Write the tables to the given file (rank 0 only)
+  void writeTables(const std::string & file_name) const;
+
+  /// Read the tables from the given file, returns false if the file does not match the requested grid
+  bool readTables(const std::string & file_name);
+
+  /// Report the largest relative interpolation error of each property at the centers of the table cells
+  void reportErrorEstimate() const;
+
+  /// Sample the table of a property if (p, T) is within range, otherwise use the wrapped UserObject
+  Real sample(TabulatedProperty property, Real pressure, Real temperature) const;
+
+  /// Same as sample() including the derivatives wrt pressure and temperature
+  void sampleDerivatives(TabulatedProperty property, Real pressure, Real temperature, Real & value, Real & dp, Real & dT) const;
+
+  /// The UserObject providing the fluid properties that are tabulated
+  const SinglePhaseFluidPropertiesPT & _fp;
+
+  ///@{ Tabulated range
+  const Real _pressure_min;
+  const Real _pressure_max;
+  const Real _temperature_min;
+  const Real _temperature_max;
+  const unsigned int _num_p;
+  const unsigned int _num_T;
+  ///@}
+
+  /// Pressure and temperature grid
+  std::vector<Real> _pressure;
+  std::vector<Real> _temperature;
+
+  /// Table values, indexed [property][pressure][temperature]
+  std::vector<std::vector<std::vector<Real> > > _tables;
+
+  /// Bicubic interpolation of each property
+  std::vector<BicubicInterpolation> _interpolation;
+
+  /// Names of the table columns
+  static const std::vector<std::string> _column_names;
+};
+
+#endif /* TABULATEDFLUIDPROPERTIES_H */
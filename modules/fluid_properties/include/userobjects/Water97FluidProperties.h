@@ -220,6 +220,13 @@ public:
    */
   virtual void h_dpT(Real pressure, Real temperature, Real & h, Real & dh_dp, Real & dh_dT) const override;
 
+  /**
+   * Density, internal energy and enthalpy and their derivatives for a batch of points.
+   * The region is determined only once per point and the Gibbs (or Helmholtz in region 3)
+   * free energy derivatives are shared between the three properties.
+   */
+  virtual void rho_e_h_dpT(const std::vector<Real> & pressure, const std::vector<Real> & temperature, BatchProperty & rho, BatchProperty & e, BatchProperty & h) const override;
+
   /**
    * Thermal expansion coefficient
    *
@@ -569,6 +576,11 @@ public:
   virtual Real henryConstant(Real temperature) const override;
 
 protected:
+  /**
+   * Derivatives of the dimensionless Gibbs free energy of region 1, 2 or 5
+   */
+  void gammaDerivatives(unsigned int region, Real pi, Real tau, Real & dg_dpi, Real & d2g_dpi2, Real & dg_dtau, Real & d2g_dtau2, Real & d2g_dpitau) const;
+
   /// Water molar mass (kg/mol)
   const Real _Mh2o;
   /// Specific gas constant for H2O (universal gas constant / molar mass of water - kJ/kg/K)
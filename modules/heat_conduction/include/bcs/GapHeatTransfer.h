@@ -30,6 +30,8 @@ protected:
  */
 
   virtual void computeResidual();
+  virtual void computeJacobian();
+  virtual void computeJacobianBlock(unsigned int jvar);
   virtual Real computeQpResidual();
   virtual Real computeQpJacobian();
   virtual Real computeQpOffDiagJacobian(unsigned jvar);
@@ -40,6 +42,13 @@ protected:
 
   virtual void computeGapValues();
 
+  /**
+   * Calls computeGapValues() if it has not been called yet for the current qp.  The gap
+   * values only depend on the qp, so they are computed once per qp rather than once
+   * for every test (and shape) function.
+   */
+  void updateGapValues();
+
   bool _gap_geometry_params_set;
   GapConductance::GAP_GEOMETRY _gap_geometry_type;
 
@@ -67,6 +76,9 @@ protected:
 
   bool _has_info;
 
+  /// The qp the gap values were last computed for, invalid_uint before the first qp of an element
+  unsigned int _gap_values_qp;
+
   const bool _xdisp_coupled;
   const bool _ydisp_coupled;
   const bool _zdisp_coupled;
@@ -10,6 +10,9 @@
 #include "Diffusion.h"
 #include "Material.h"
 
+// C++ includes
+#include <unordered_map>
+
 //Forward Declarations
 class HeatConductionKernel;
 
@@ -28,15 +31,39 @@ public:
 
   HeatConductionKernel(const InputParameters & parameters);
 
+  virtual void computeResidual();
+  virtual void computeJacobian();
+
+  /// Clears the element matrices, which are built again for the new mesh
+  virtual void meshChanged();
+
 protected:
   virtual Real computeQpResidual();
 
   virtual Real computeQpJacobian();
 
+  virtual bool hasJacobianCoefficients(unsigned int jvar);
+  virtual void computeQpJacobianCoefficients(unsigned int jvar, RealTensorValue & D, RealVectorValue & b, Real & c);
+
+  /**
+   * The stiffness matrix of the current element, built on the first use.  The residual is
+   * then the product of this matrix with the nodal temperatures.
+   */
+  const DenseMatrix<Number> & elementMatrix();
+
 private:
   const unsigned _dim;
   const MaterialProperty<Real> & _diffusion_coefficient;
   const MaterialProperty<Real> * const _diffusion_coefficient_dT;
+
+  /// Whether the element matrices are stored (the "cache_element_matrix" parameter)
+  const bool _cache_element_matrix;
+
+  /// The nodal temperatures of the current element, only used with cache_element_matrix
+  const VariableValue * const _nodal_u;
+
+  /// The stored element matrices, by element id
+  std::unordered_map<dof_id_type, DenseMatrix<Number> > _element_matrices;
 };
 
 #endif //HEATCONDUCTIONKERNEL_H
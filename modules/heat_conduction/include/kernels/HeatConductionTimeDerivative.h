@@ -11,6 +11,9 @@
 #include "TimeDerivative.h"
 #include "Material.h"
 
+// C++ includes
+#include <unordered_map>
+
 // Forward Declarations
 class HeatConductionTimeDerivative;
 
@@ -31,6 +34,12 @@ public:
   /// Contructor for Heat Equation time derivative term.
   HeatConductionTimeDerivative(const InputParameters & parameters);
 
+  virtual void computeResidual();
+  virtual void computeJacobian();
+
+  /// Clears the element matrices, which are built again for the new mesh
+  virtual void meshChanged();
+
 protected:
   /// Compute the residual of the Heat Equation time derivative.
   virtual Real computeQpResidual();
@@ -38,8 +47,23 @@ protected:
   /// Compute the jacobian of the Heat Equation time derivative.
   virtual Real computeQpJacobian();
 
+  /**
+   * The mass matrix of the current element, built on the first use.  The residual is
+   * then the product of this matrix with the nodal temperature rates.
+   */
+  const DenseMatrix<Number> & elementMatrix();
+
   const MaterialProperty<Real> & _specific_heat;
   const MaterialProperty<Real> & _density;
+
+  /// Whether the element matrices are stored (the "cache_element_matrix" parameter)
+  const bool _cache_element_matrix;
+
+  /// The nodal temperature rates of the current element, only used with cache_element_matrix
+  const VariableValue * const _nodal_u_dot;
+
+  /// The stored element matrices, by element id
+  std::unordered_map<dof_id_type, DenseMatrix<Number> > _element_matrices;
 };
 
 #endif //HEATCONDUCTIONTIMEDERIVATIVE_H
@@ -106,6 +106,10 @@ protected:
   PenetrationLocator * _penetration_locator;
   const NumericVector<Number> * * _serialized_solution;
   DofMap * _dof_map;
+
+  /// The temperature DOFs of the side across the gap, kept as a member so they are not reallocated at every qp
+  std::vector<dof_id_type> _slave_side_dof_indices;
+
   const bool _warnings;
 
   Point _p1;
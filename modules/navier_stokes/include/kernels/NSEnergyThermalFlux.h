@@ -8,7 +8,6 @@
 #define NSENERGYTHERMALFLUX_H
 
 #include "NSKernel.h"
-#include "NSTemperatureDerivs.h"
 
 // ForwardDeclarations
 class NSEnergyThermalFlux;
@@ -37,13 +36,9 @@ protected:
   // Material properties
   const MaterialProperty<Real> &_thermal_conductivity;
 
-  // A helper object for computing temperature gradient and Hessians.
-  // Constructed via a reference to ourself so we can access all of our data.
-  NSTemperatureDerivs<NSEnergyThermalFlux> _temp_derivs;
-
-  // Declare ourselves a friend to the helper class
-  template <class U>
-  friend class NSTemperatureDerivs;
+  // Temperature gradient and Hessian with respect to the conserved variables
+  const MaterialProperty<std::vector<Real> > & _dtemperature_dU;
+  const MaterialProperty<std::vector<std::vector<Real> > > & _d2temperature_dU2;
 
 private:
   // Computes the Jacobian value (on or off-diagonal) for
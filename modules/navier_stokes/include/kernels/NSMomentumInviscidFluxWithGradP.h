@@ -8,7 +8,6 @@
 #define NSMOMENTUMINVISCIDFLUXWITHGRADP_H
 
 #include "NSKernel.h"
-#include "NSPressureDerivs.h"
 
 // ForwardDeclarations
 class NSMomentumInviscidFluxWithGradP;
@@ -42,13 +41,9 @@ private:
   // the ctor.
   std::vector<const VariableGradient *> _gradU;
 
-  // An object for computing pressure derivatives.
-  // Constructed via a reference to ourself
-  NSPressureDerivs<NSMomentumInviscidFluxWithGradP> _pressure_derivs;
-
-  // Declare ourselves friend to the helper class.
-  template <class U>
-  friend class NSPressureDerivs;
+  // Pressure gradient and Hessian with respect to the conserved variables
+  const MaterialProperty<std::vector<Real> > & _dpressure_dU;
+  const MaterialProperty<std::vector<std::vector<Real> > > & _d2pressure_dU2;
 };
 
 #endif //NSMOMENTUMINVISCIDFLUXWITHGRADP_H
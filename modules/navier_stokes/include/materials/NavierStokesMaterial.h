@@ -8,6 +8,8 @@
 #define NAVIERSTOKESMATERIAL_H
 
 #include "Material.h"
+#include "NSPressureDerivs.h"
+#include "NSTemperatureDerivs.h"
 
 // Forward Declarations
 class NavierStokesMaterial;
@@ -67,6 +69,15 @@ protected:
   // See notes for additional details.
   MaterialProperty<std::vector<std::vector<RealTensorValue> > > & _calE;
 
+  // The derivatives of the pressure and temperature with respect to the
+  // conserved variables, in the "canonical" numbering (rho, rho*u, rho*v,
+  // rho*w, rho*E).  These are needed in the Jacobians of several kernels,
+  // so they are computed once per qp here rather than in every kernel.
+  MaterialProperty<std::vector<Real> > & _dpressure_dU;
+  MaterialProperty<std::vector<std::vector<Real> > > & _d2pressure_dU2;
+  MaterialProperty<std::vector<Real> > & _dtemperature_dU;
+  MaterialProperty<std::vector<std::vector<Real> > > & _d2temperature_dU2;
+
   // Convenient storage for all of the velocity gradient components so
   // we can refer to them in a loop.
   std::vector<const VariableGradient *> _vel_grads;
@@ -127,6 +138,20 @@ private:
 
   // To be called from computeProperties() function to compute the strong residual of each equation.
   void computeStrongResiduals(unsigned int qp);
+
+  // To be called from computeProperties() function to compute the pressure and temperature derivatives.
+  void computeThermodynamicDerivatives(unsigned int qp);
+
+  // Helper objects for computing the pressure and temperature derivatives,
+  // constructed via a reference to ourself so they can access our data.
+  NSPressureDerivs<NavierStokesMaterial> _pressure_derivs;
+  NSTemperatureDerivs<NavierStokesMaterial> _temp_derivs;
+
+  // Declare ourselves a friend to the helper classes
+  template <class U>
+  friend class NSPressureDerivs;
+  template <class U>
+  friend class NSTemperatureDerivs;
 };
 
 #endif //NAVIERSTOKESMATERIAL_H
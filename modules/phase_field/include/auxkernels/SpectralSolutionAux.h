@@ -0,0 +1,35 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef SPECTRALSOLUTIONAUX_H
+#define SPECTRALSOLUTIONAUX_H
+
+#include "AuxKernel.h"
+
+//Forward Declarations
+class SpectralSolutionAux;
+class SpectralPhaseFieldSolver;
+
+template<>
+InputParameters validParams<SpectralSolutionAux>();
+
+/**
+ * Copies the grid values advanced by a SpectralPhaseFieldSolver back onto the
+ * nodes of the mesh.
+ */
+class SpectralSolutionAux : public AuxKernel
+{
+public:
+  SpectralSolutionAux(const InputParameters & parameters);
+
+protected:
+  virtual Real computeValue();
+
+  /// The solver holding the advanced grid values
+  const SpectralPhaseFieldSolver & _solver;
+};
+
+#endif //SPECTRALSOLUTIONAUX_H
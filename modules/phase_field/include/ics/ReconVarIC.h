@@ -48,7 +48,7 @@ private:
   std::vector<Point> _centerpoints;
   std::vector<unsigned int> _assigned_op;
 
-  const std::map<dof_id_type, std::vector<Real> > & _node_to_grain_weight_map;
+  const std::map<dof_id_type, EBSDReader::GrainWeights> & _node_to_grain_weight_map;
 };
 
 #endif //RECONVARIC_H
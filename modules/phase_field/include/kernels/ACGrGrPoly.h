@@ -19,21 +19,47 @@ InputParameters validParams<ACGrGrPoly>();
  * This kernel calculates the residual for grain growth.
  * It calculates the residual of the ith order parameter, and the values of
  * all other order parameters are coupled variables and are stored in vals.
+ *
+ * Only a few of the order parameters are non-zero on any element, so the sum of
+ * squares is built once per element from the locally active ones, and the
+ * off-diagonal Jacobian blocks of inactive order parameters (which vanish) are skipped.
  */
 class ACGrGrPoly : public ACBulk<Real>
 {
 public:
   ACGrGrPoly(const InputParameters & parameters);
 
+  virtual void computeResidual();
+  virtual void computeJacobian();
+  virtual void computeOffDiagJacobian(unsigned int jvar);
+
 protected:
   virtual Real computeDFDOP(PFFunctionType type);
   virtual Real computeQpOffDiagJacobian(unsigned int jvar);
 
+  /// Index into _vals of the order parameter with variable number jvar, _op_num if jvar is not one of them
+  unsigned int opIndex(unsigned int jvar) const;
+
+  /// Whether an order parameter exceeds the activity threshold anywhere on the current element
+  bool isActive(const VariableValue & val) const;
+
+  /// Sum the squares of the active order parameters at each quadrature point of the current element
+  void computeSumEtaj();
+
   const unsigned int _op_num;
 
   std::vector<const VariableValue *> _vals;
   std::vector<unsigned int> _vals_var;
 
+  /// Maps variable numbers to indices into _vals
+  std::vector<unsigned int> _op_index;
+
+  /// Order parameters that do not exceed this value on an element are treated as zero there
+  const Real _active_op_threshold;
+
+  /// Sum of squares of the other order parameters at the quadrature points
+  std::vector<Real> _sum_etaj;
+
   const MaterialProperty<Real> & _mu;
   const MaterialProperty<Real> & _gamma;
   const MaterialProperty<Real> & _tgrad_corr_mult;
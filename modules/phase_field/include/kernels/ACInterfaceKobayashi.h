@@ -0,0 +1,71 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef ACINTERFACEKOBAYASHI_H
+#define ACINTERFACEKOBAYASHI_H
+
+#include "Kernel.h"
+#include "JvarMapInterface.h"
+#include "DerivativeMaterialInterface.h"
+
+class ACInterfaceKobayashi;
+
+template<>
+InputParameters validParams<ACInterfaceKobayashi>();
+
+/**
+ * Interfacial energy anisotropy in the Allen-Cahn equation as implemented in
+ * R. Kobayashi, Physica D, 63, 410-423 (1993). doi:10.1016/0167-2789(93)90120-P
+ * This kernel implements all three terms on the right side of eq. (3) of the paper,
+ * i.e. ACInterfaceKobayashi1 and ACInterfaceKobayashi2 combined. The material properties
+ * are combined into a few coefficients once per quadrature point and element, which
+ * are then contracted with the test and shape function gradients.
+ */
+class ACInterfaceKobayashi : public DerivativeMaterialInterface<JvarMapKernelInterface<Kernel> >
+{
+public:
+  ACInterfaceKobayashi(const InputParameters & parameters);
+
+protected:
+  virtual void precalculateResidual();
+  virtual void precalculateJacobian();
+  virtual void precalculateOffDiagJacobian(unsigned int jvar);
+
+  virtual Real computeQpResidual();
+  virtual Real computeQpJacobian();
+  virtual Real computeQpOffDiagJacobian(unsigned int jvar);
+
+  /// Mobility
+  const MaterialProperty<Real> & _L;
+
+  /// Interfacial parameter and its derivatives
+  const MaterialProperty<Real> & _eps;
+  const MaterialProperty<Real> & _deps;
+  const MaterialProperty<RealGradient> & _depsdgrad_op;
+  const MaterialProperty<RealGradient> & _ddepsdgrad_op;
+
+  /// Mobility and interfacial parameter derivatives w.r.t. other coupled variables
+  std::vector<const MaterialProperty<Real> *> _dLdarg;
+  std::vector<const MaterialProperty<Real> *> _depsdarg;
+  std::vector<const MaterialProperty<Real> *> _ddepsdarg;
+
+  /// Residual flux L * (eps * deps * v + eps^2 * grad_u) per qp, with v the rotated gradient
+  std::vector<RealGradient> _flux;
+
+  /// Derivative of the residual flux w.r.t. the coupled variable of the current off-diagonal block per qp
+  std::vector<RealGradient> _dflux;
+
+  ///@{ Jacobian coefficients per qp, with dv the rotated shape function gradient:
+  /// L * eps * deps * dv + L * eps^2 * grad_phi + (_dv_coef * grad_phi) * v + (_dgrad_u_coef * grad_phi) * grad_u
+  std::vector<RealGradient> _v;
+  std::vector<Real> _eps_deps_L;
+  std::vector<Real> _eps_sq_L;
+  std::vector<RealGradient> _dv_coef;
+  std::vector<RealGradient> _dgrad_u_coef;
+  ///@}
+};
+
+#endif //ACINTERFACEKOBAYASHI_H
@@ -22,6 +22,13 @@ protected:
   virtual Real computeQpJacobian();
   virtual Real computeQpOffDiagJacobian(unsigned int jvar);
 
+  virtual void precalculateResidual();
+  virtual void precalculateJacobian();
+  virtual void precalculateOffDiagJacobian(unsigned int jvar);
+
+  /// Sum the gradients of all the L variables at every qp of the element in one pass
+  void computeSumGradL();
+
 private:
   const MaterialProperty<Real> & _M;
   bool _has_MJac;
@@ -37,6 +44,12 @@ private:
   Real _c;
 
   unsigned int _num_L;
+
+  /// Half the sum of the gradients of the L variables, per qp
+  std::vector<RealGradient> _sum_grad_L;
+
+  /// Whether the variable of the current off-diagonal Jacobian is one of the L variables
+  bool _jvar_is_L;
 };
 
 #endif //CHPFCRFF_H
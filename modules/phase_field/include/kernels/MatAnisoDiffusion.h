@@ -18,6 +18,9 @@ class MatAnisoDiffusion : public MatDiffusionBase<RealTensorValue>
 {
 public:
   MatAnisoDiffusion(const InputParameters & parameters);
+
+protected:
+  virtual bool hasJacobianCoefficients(unsigned int jvar);
 };
 
 template<>
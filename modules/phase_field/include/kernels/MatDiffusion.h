@@ -18,6 +18,9 @@ class MatDiffusion : public MatDiffusionBase<Real>
 {
 public:
   MatDiffusion(const InputParameters & parameters);
+
+protected:
+  virtual bool hasJacobianCoefficients(unsigned int jvar);
 };
 
 template<>
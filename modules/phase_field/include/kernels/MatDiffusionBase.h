@@ -37,6 +37,11 @@ protected:
   virtual Real computeQpOffDiagJacobian(unsigned int jvar);
   virtual Real computeQpCJacobian();
 
+  virtual void computeQpJacobianCoefficients(unsigned int jvar, RealTensorValue & D, RealVectorValue & b, Real & c);
+
+  /// Convert the diffusion coefficient to a tensor for computeQpJacobianCoefficients()
+  static RealTensorValue coefficientTensor(const T & D);
+
   /// diffusion coefficient
   const MaterialProperty<T> & _D;
 
@@ -127,4 +132,37 @@ MatDiffusionBase<T>::computeQpCJacobian()
 {
   return _D[_qp] * _grad_phi[_j][_qp] * _grad_test[_i][_qp];
 }
+
+template<typename T>
+void
+MatDiffusionBase<T>::computeQpJacobianCoefficients(unsigned int jvar, RealTensorValue & D, RealVectorValue & b, Real & /*c*/)
+{
+  if (jvar == _var.number())
+    b = _dDdc[_qp] * _grad_conc[_qp];
+  else
+  {
+    unsigned int cvar;
+    if (mapJvarToCvar(jvar, cvar))
+      b = (*_dDdarg[cvar])[_qp] * _grad_conc[_qp];
+  }
+
+  if (jvar == _conc_var)
+    D = coefficientTensor(_D[_qp]);
+}
+
+template<>
+inline RealTensorValue
+MatDiffusionBase<Real>::coefficientTensor(const Real & D)
+{
+  return RealTensorValue(D, 0, 0,
+                         0, D, 0,
+                         0, 0, D);
+}
+
+template<>
+inline RealTensorValue
+MatDiffusionBase<RealTensorValue>::coefficientTensor(const RealTensorValue & D)
+{
+  return D;
+}
 #endif //MATDIFFUSIONBASE_H
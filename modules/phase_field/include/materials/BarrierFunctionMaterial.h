@@ -27,6 +27,9 @@ class BarrierFunctionMaterial : public OrderParameterFunctionMaterial
 public:
   BarrierFunctionMaterial(const InputParameters & parameters);
 
+  /// Evaluate \f$ g(\eta) \f$ and its first two derivatives for the polynomial order g_order
+  static void computeBarrierFunction(unsigned int g_order, bool well_only, Real eta, Real & g, Real & dg, Real & d2g);
+
 protected:
   virtual void computeQpProperties();
 
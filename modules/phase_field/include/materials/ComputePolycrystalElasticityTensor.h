@@ -43,6 +43,12 @@ protected:
 
   /// Conversion factor from J to eV
   const Real _JtoeV;
+
+  /// Active grain ids of the order parameters on the current element
+  const std::vector<unsigned int> * _op_to_grains;
+
+  /// Derivative of the interpolation function for each active order parameter at the current qp
+  std::vector<Real> _dhdopi;
 };
 
 #endif //COMPUTEPOLYCRYSTALELASTICITYTENSOR_H
@@ -29,10 +29,16 @@ public:
 protected:
   virtual void computeProperties();
 
+  /// Drop the function value and the derivatives that are not requested by any object
+  virtual void initialSetup();
+
   virtual void functionsPostParse();
   void assembleDerivatives();
   MatPropDescriptorList::iterator findMatPropDerivative(const FunctionMaterialPropertyDescriptor &);
 
+  /// The JIT cache key of the derivative of the parsed function w.r.t. the listed arguments
+  std::string derivativeJITKey(const std::vector<unsigned int> & dargs) const;
+
   struct QueueItem;
   struct Derivative;
 
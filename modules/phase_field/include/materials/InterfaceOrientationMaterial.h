@@ -31,6 +31,7 @@ protected:
 private:
   Real _delta;
   unsigned int _j;
+  /// Reference angle in radians
   Real _theta0;
   Real _eps_bar;
 
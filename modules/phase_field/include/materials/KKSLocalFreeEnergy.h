@@ -0,0 +1,91 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef KKSLOCALFREEENERGY_H
+#define KKSLOCALFREEENERGY_H
+
+#include "DerivativeFunctionMaterialBase.h"
+#include "FunctionParserUtils.h"
+
+// Forward Declarations
+class KKSLocalFreeEnergy;
+
+template<>
+InputParameters validParams<KKSLocalFreeEnergy>();
+
+/**
+ * Two phase KKS free energy with the phase concentrations solved for locally.
+ * At every qp a nested Newton solve finds the phase concentrations \f$ c_a, c_b \f$ that fulfill
+ * \f$ c = (1-h(\eta)) c_a + h(\eta) c_b \f$ and \f$ \frac{dF_a}{dc_a} = \frac{dF_b}{dc_b} \f$.
+ * The resulting free energy \f$ F(c, \eta) = (1-h) F_a(c_a) + h F_b(c_b) + w g(\eta) \f$ and
+ * its first and second derivatives with respect to \f$ c \f$ and \f$ \eta \f$ (through the implicit
+ * dependence of the phase concentrations) are provided as regular derivative material properties.
+ * This allows the KKS model to be run with the SplitCHParsed and AllenCahn kernels, without the
+ * phase concentration variables and the KKSPhaseConcentration/KKSPhaseChemicalPotential constraints.
+ *
+ * The phase free energies are given as parsed expressions in ca and cb respectively.
+ */
+class KKSLocalFreeEnergy : public DerivativeFunctionMaterialBase, public FunctionParserUtils
+{
+public:
+  KKSLocalFreeEnergy(const InputParameters & parameters);
+
+protected:
+  virtual void computeProperties();
+
+  virtual Real computeF();
+  virtual Real computeDF(unsigned int j_var);
+  virtual Real computeD2F(unsigned int j_var, unsigned int k_var);
+
+  /// Parse a phase free energy and take its first and second derivatives
+  void parsePhaseFunction(const std::string & expression, const std::string & variable, ADFunctionPtr func[3]);
+
+  /// Solve for the phase concentrations at the current qp
+  void solveLocal();
+
+  /// Global concentration and order parameter
+  const VariableValue & _c;
+  unsigned int _c_var;
+  unsigned int _eta_var;
+
+  ///@{ Switching function and its derivatives
+  const MaterialProperty<Real> & _h;
+  const MaterialProperty<Real> & _dh;
+  const MaterialProperty<Real> & _d2h;
+  ///@}
+
+  ///@{ Double well height and double well function and its derivatives
+  const Real _w;
+  const MaterialProperty<Real> & _g;
+  const MaterialProperty<Real> & _dg;
+  const MaterialProperty<Real> & _d2g;
+  ///@}
+
+  ///@{ Phase free energies and their first and second derivatives
+  ADFunctionPtr _fa[3];
+  ADFunctionPtr _fb[3];
+  ///@}
+
+  /// Maximum number of local Newton iterations
+  const unsigned int _nl_max_its;
+
+  /// Absolute tolerance of the local Newton residuals
+  const Real _abs_tol;
+
+  ///@{ The phase concentrations
+  MaterialProperty<Real> & _ca;
+  MaterialProperty<Real> & _cb;
+  ///@}
+
+  /// The phase free energies and derivatives at the solution on each qp
+  struct LocalSolution
+  {
+    Real fa, fb, mu, d2fa, d2fb;
+  };
+  std::vector<LocalSolution> _solution;
+};
+
+#endif //KKSLOCALFREEENERGY_H
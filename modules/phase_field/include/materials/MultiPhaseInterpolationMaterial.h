@@ -0,0 +1,60 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef MULTIPHASEINTERPOLATIONMATERIAL_H
+#define MULTIPHASEINTERPOLATIONMATERIAL_H
+
+#include "Material.h"
+#include "DerivativeMaterialInterface.h"
+
+// Forward Declarations
+class MultiPhaseInterpolationMaterial;
+
+template<>
+InputParameters validParams<MultiPhaseInterpolationMaterial>();
+
+/**
+ * Material to provide the switching functions \f$ h_i(\eta_i) \f$ and the
+ * barrier functions \f$ g_i(\eta_i) \f$ of all the order parameters, with
+ * their first and second derivatives, in one loop per qp. This replaces one
+ * SwitchingFunctionMaterial and one BarrierFunctionMaterial per order parameter
+ * and declares the same properties.
+ *
+ * \see SwitchingFunctionMaterial
+ * \see BarrierFunctionMaterial
+ */
+class MultiPhaseInterpolationMaterial : public DerivativeMaterialInterface<Material>
+{
+public:
+  MultiPhaseInterpolationMaterial(const InputParameters & parameters);
+
+protected:
+  virtual void computeQpProperties();
+
+  /// Polynomial order of each function, from a list with one entry or one entry per order parameter
+  std::vector<unsigned int> orders(const std::string & param) const;
+
+  /// order parameters
+  unsigned int _num_eta;
+  std::vector<const VariableValue *> _eta;
+
+  /// Polynomial orders of the switching functions \f$ h_i(\eta_i) \f$
+  std::vector<unsigned int> _h_order;
+
+  /// Polynomial orders of the barrier functions \f$ g_i(\eta_i) \f$
+  std::vector<unsigned int> _g_order;
+
+  /// zero out g contribution in the eta interval [0:1]
+  bool _well_only;
+
+  /// Switching functions and their derivatives, empty if no h_names are given
+  std::vector<MaterialProperty<Real> *> _prop_h, _prop_dh, _prop_d2h;
+
+  /// Barrier functions and their derivatives, empty if no g_names are given
+  std::vector<MaterialProperty<Real> *> _prop_g, _prop_dg, _prop_d2g;
+};
+
+#endif //MULTIPHASEINTERPOLATIONMATERIAL_H
@@ -55,9 +55,18 @@ protected:
   // run FPOptimizer on the parsed function
   virtual void functionsOptimize();
 
+  /**
+   * Fill _func_params_qp with the function arguments at every quadrature point of the
+   * current element, so that each function can be evaluated over the element in one loop
+   */
+  void gatherParameters();
+
   /// The undiffed free energy function parser object.
   ADFunctionPtr _func_F;
 
+  /// Description of the parsed function used for the JIT cache
+  std::string _jit_key;
+
   /// variable names used in the expression (depends on the map_mode)
   std::vector<std::string> _variable_names;
 
@@ -70,6 +79,9 @@ protected:
   /// Tolerance values for all arguments (to protect from log(0)).
   std::vector<Real> _tol;
 
+  /// The function arguments at each quadrature point, stored one quadrature point after the other
+  std::vector<Real> _func_params_qp;
+
   /**
    * Flag to indicate if MOOSE nonlinear variable names should be used as FParser variable names.
    * This should be true only for DerivativeParsedMaterial. If set to false, this class looks up the
@@ -27,6 +27,9 @@ class SwitchingFunctionMaterial : public OrderParameterFunctionMaterial
 public:
   SwitchingFunctionMaterial(const InputParameters & parameters);
 
+  /// Evaluate \f$ h(\eta) \f$ and its first two derivatives for the polynomial order h_order
+  static void computeSwitchingFunction(unsigned int h_order, Real eta, Real & h, Real & dh, Real & d2h);
+
 protected:
   virtual void computeQpProperties();
 
@@ -341,7 +341,8 @@ protected:
 
   /**
    * This routine is called on the master rank only and stitches together the partial
-   * feature pieces seen on any processor.
+   * feature pieces seen on any processor. Only pieces touching a processor or periodic
+   * boundary are compared and the connected groups are merged in a single pass.
    */
   void mergeSets(bool use_periodic_boundary_info);
 
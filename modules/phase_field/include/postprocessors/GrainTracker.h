@@ -103,6 +103,7 @@ protected:
   /**
    * Broadcast essential Grain information to all processors. This method is used to get certain
    * attributes like centroids distributed and whether or not a grain intersects a boundary updated.
+   * Only the records that changed since the last broadcast are sent.
    */
   void broadcastAndUpdateGrainData();
 
@@ -123,14 +124,15 @@ protected:
    * A routine for moving all of the solution values from a given grain to a new variable number. It is called
    * with different modes to only cache, or actually do the work, or bypass the cache altogether.
    */
-  void swapSolutionValues(FeatureData &  grain, std::size_t new_var_index, std::vector<std::map<Node *, CacheValues> > & cache,
+  void swapSolutionValues(FeatureData &  grain, std::size_t new_var_index, std::vector<CacheValues> & cache,
                           RemapCacheMode cache_mode);
 
   /**
-   * Helper method for actually performing the swaps.
+   * Helper method for actually performing the swaps. The cache is indexed by the local DOF
+   * (relative to the first local DOF of the nonlinear system) of the variable being swapped from.
    */
   void swapSolutionValuesHelper(Node * curr_node, std::size_t curr_var_index, std::size_t new_var_index,
-                                std::vector<std::map<Node *, CacheValues> > & cache, RemapCacheMode cache_mode);
+                                std::vector<CacheValues> & cache, RemapCacheMode cache_mode);
 
   /**
    * This method returns the minimum periodic distance between two vectors of bounding boxes. If the bounding boxes overlap
@@ -223,6 +225,9 @@ private:
 
   /// Boolean to indicate whether this is a Steady or Transient solve
   const bool _is_transient;
+
+  /// The grain data from the last broadcast, indexed by grain id (the same on every rank)
+  std::map<unsigned int, PartialFeatureData> _partial_feature_data;
 };
 
 
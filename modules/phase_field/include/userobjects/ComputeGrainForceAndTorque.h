@@ -11,6 +11,9 @@
 #include "GrainForceAndTorqueInterface.h"
 #include "DerivativeMaterialInterface.h"
 
+// C++ includes
+#include <map>
+
 //Forward Declarations
 class ComputeGrainForceAndTorque;
 class GrainTrackerInterface;
@@ -71,6 +74,11 @@ protected:
   std::vector<Real> _force_torque_c_jacobian_store;
   std::vector<std::vector<Real> > _force_torque_eta_jacobian_store;
 
+  ///@{ nonzero entries of the jacobians (index in the stores above -> value) accumulated on this processor
+  std::map<dof_id_type, Real> _force_torque_c_jacobian_entries;
+  std::vector<std::map<dof_id_type, Real> > _force_torque_eta_jacobian_entries;
+  ///@}
+
   unsigned int _total_dofs;
 };
 
@@ -35,6 +35,15 @@ public:
   const std::vector<Real> & nuclei(const Elem *) const;
 
 protected:
+  /// Sort the nuclei into the cells of the spatial hash
+  void binNuclei();
+
+  /// Hash cell index of a point in each direction
+  void cellIndex(const Point & p, int index[3]) const;
+
+  /// Flattened key of a hash cell
+  unsigned long int cellKey(const int index[3]) const;
+
   /// Did the mesh change since the last execution of this PP?
   bool _mesh_changed;
 
@@ -62,6 +71,14 @@ protected:
   /// list of nuclei maintained bu the inserter object
   const DiscreteNucleationInserter::NucleusList & _nucleus_list;
 
+  ///@{ Spatial hash of the nuclei, the cells are at least as large as the nucleus cutoff radius
+  Point _cell_origin;
+  Point _cell_size;
+  int _n_cells[3];
+  bool _periodic_dir[3];
+  LIBMESH_BEST_UNORDERED_MAP<unsigned long int, std::vector<unsigned int> > _nucleus_bins;
+  ///@}
+
   ///@{
   /// Per element list with 0/1 flags indicating the presence of a nucleus
   typedef LIBMESH_BEST_UNORDERED_MAP<dof_id_type, std::vector<Real> > NucleusMap;
@@ -92,15 +92,20 @@ public:
   /// Factory function to return a average functor specified by name
   MooseSharedPointer<EBSDAvgDataFunctor> getAvgDataAccessFunctor(const MooseEnum & field_name) const;
 
+  /// The (global) grain ids with a non-zero weight at a node and their weights
+  typedef std::vector<std::pair<unsigned int, Real> > GrainWeights;
+
   /**
-   * Returns a map consisting of the node index followd by
-   * a vector of all grain weights for that node. Needed by ReconVarIC
+   * Returns a map consisting of the node index followed by the (global) grain ids
+   * with a non-zero weight at that node, in increasing order, and their weights.
+   * Only the nodes of the local elements are contained. Needed by ReconVarIC
    */
-  const std::map<dof_id_type, std::vector<Real> > & getNodeToGrainWeightMap() const;
+  const std::map<dof_id_type, GrainWeights> & getNodeToGrainWeightMap() const;
 
   /**
    * Returns a map consisting of the node index followd by
-   * a vector of all phase weights for that node. Needed by ReconPhaseVarIC
+   * a vector of all phase weights for that node. Only the nodes of the
+   * local elements are contained. Needed by ReconPhaseVarIC
    */
   const std::map<dof_id_type, std::vector<Real> > & getNodeToPhaseWeightMap() const;
 
@@ -138,8 +143,8 @@ protected:
   /// global ID for given phases and grains
   std::vector<std::vector<unsigned int> > _global_id;
 
-  /// Map of grain weights per node
-  std::map<dof_id_type, std::vector<Real> > _node_to_grain_weight_map;
+  /// Map of the non-zero grain weights per node
+  std::map<dof_id_type, GrainWeights> _node_to_grain_weight_map;
 
   /// Map of phase weights per node
   std::map<dof_id_type, std::vector<Real> > _node_to_phase_weight_map;
@@ -0,0 +1,90 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef SPECTRALPHASEFIELDSOLVER_H
+#define SPECTRALPHASEFIELDSOLVER_H
+
+#include "ElementUserObject.h"
+#include "DerivativeMaterialInterface.h"
+
+class SpectralPhaseFieldSolver;
+
+template<>
+InputParameters validParams<SpectralPhaseFieldSolver>();
+
+/**
+ * Advances a Cahn-Hilliard or Allen-Cahn equation on a periodic, regular
+ * GeneratedMesh by one time step with a semi-implicit Fourier spectral scheme.
+ * The gradient energy term is treated implicitly and the bulk chemical potential,
+ * taken from the derivative of a free energy material, explicitly.
+ *
+ * The variable is an AuxVariable on the nodes of the mesh. The values and the
+ * chemical potential are sampled at the quadrature points, so TRAP quadrature is
+ * required to place those on the nodes. The full grid is gathered on every
+ * processor, transformed, advanced and handed back to the nodes through a
+ * SpectralSolutionAux.
+ */
+class SpectralPhaseFieldSolver : public DerivativeMaterialInterface<ElementUserObject>
+{
+public:
+  SpectralPhaseFieldSolver(const InputParameters & parameters);
+
+  virtual void initialize();
+  virtual void execute();
+  virtual void threadJoin(const UserObject & y);
+  virtual void finalize();
+
+  /// The advanced value at the grid point p lies on
+  Real value(const Point & p) const;
+
+protected:
+  /// The index of the grid point p lies on
+  unsigned int gridIndex(const Point & p) const;
+
+  /// The equations that can be advanced
+  enum class Equation
+  {
+    CAHN_HILLIARD,
+    ALLEN_CAHN
+  };
+
+  /// The equation to advance
+  const Equation _equation;
+
+  /// The current values of the variable
+  const VariableValue & _u;
+
+  /// Derivative of the free energy density with respect to the variable
+  const MaterialProperty<Real> & _dFdu;
+
+  /// Mobility (Cahn-Hilliard) or kinetic coefficient (Allen-Cahn)
+  const Real _mobility;
+
+  /// Gradient energy coefficient
+  const Real _kappa;
+
+  /// Number of grid points in each dimension
+  std::vector<unsigned int> _grid;
+
+  ///@{ Lower corner and grid spacing of the domain
+  Point _min_corner;
+  Point _spacing;
+  ///@}
+
+  /// Domain length in each dimension
+  std::vector<Real> _length;
+
+  ///@{ Sums of the sampled values and derivatives and number of samples for each grid point
+  std::vector<Real> _u_sum;
+  std::vector<Real> _dFdu_sum;
+  std::vector<unsigned int> _count;
+  ///@}
+
+  /// The grid values after the time step
+  std::vector<Real> _u_new;
+};
+
+#endif //SPECTRALPHASEFIELDSOLVER_H
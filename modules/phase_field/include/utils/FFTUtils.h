@@ -0,0 +1,28 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef FFTUTILS_H
+#define FFTUTILS_H
+
+#include "Moose.h"
+#include "libmesh/libmesh.h"
+
+#include <complex>
+
+namespace FFTUtils
+{
+/// true if n is a (non-zero) power of two
+bool isPowerOfTwo(unsigned int n);
+
+/**
+ * In-place radix-2 fast Fourier transform of a row major array with the
+ * supplied extents (each a power of two). The inverse transform includes the
+ * 1/N normalization, so that transform(transform(a), inverse) == a.
+ */
+void transform(std::vector<std::complex<Real> > & data, const std::vector<unsigned int> & extents, bool inverse);
+}
+
+#endif //FFTUTILS_H
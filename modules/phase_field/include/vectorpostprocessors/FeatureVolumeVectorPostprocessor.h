@@ -56,21 +56,10 @@ protected:
   VectorPostprocessorValue & _intersects_bounds;
 
 private:
-  /// Add volume contributions to one or entries in the feature volume vector
-  void accumulateVolumes(const Elem * elem, const std::vector<unsigned int> & var_to_features, std::size_t num_features);
-
-  /// Calculate the integral value of the passed in variable (index)
-  Real computeIntegral(std::size_t var_index) const;
-
+  /// The variables of the feature counter (on thread 0)
   const std::vector<MooseVariable *> & _vars;
-  std::vector<const VariableValue *> _coupled_sln;
 
   MooseMesh & _mesh;
-  Assembly & _assembly;
-  const MooseArray<Point> & _q_point;
-  QBase * & _qrule;
-  const MooseArray<Real> & _JxW;
-  const MooseArray<Real> & _coord;
 };
 
 #endif
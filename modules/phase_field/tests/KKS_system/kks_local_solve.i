@@ -0,0 +1,164 @@
+#
+# KKS toy problem of kks_example_split.i with the phase concentrations
+# solved for locally in the free energy material
+#
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 15
+  ny = 15
+  xmin = -2.5
+  xmax = 2.5
+  ymin = -2.5
+  ymax = 2.5
+  elem_type = QUAD4
+[]
+
+[Variables]
+  # order parameter
+  [./eta]
+  [../]
+
+  # hydrogen concentration
+  [./c]
+  [../]
+
+  # chemical potential
+  [./w]
+  [../]
+[]
+
+[ICs]
+  [./eta]
+    variable = eta
+    type = SmoothCircleIC
+    x1 = 0.0
+    y1 = 0.0
+    radius = 1.5
+    invalue = 0.2
+    outvalue = 0.1
+    int_width = 0.75
+  [../]
+  [./c]
+    variable = c
+    type = SmoothCircleIC
+    x1 = 0.0
+    y1 = 0.0
+    radius = 1.5
+    invalue = 0.6
+    outvalue = 0.4
+    int_width = 0.75
+  [../]
+[]
+
+[BCs]
+  [./Periodic]
+    [./all]
+      variable = 'eta w c'
+      auto_direction = 'x y'
+    [../]
+  [../]
+[]
+
+[Materials]
+  # h(eta)
+  [./h_eta]
+    type = SwitchingFunctionMaterial
+    h_order = HIGH
+    eta = eta
+  [../]
+
+  # g(eta)
+  [./g_eta]
+    type = BarrierFunctionMaterial
+    g_order = SIMPLE
+    eta = eta
+  [../]
+
+  # KKS free energy of the matrix (ca) and delta phase (cb)
+  [./free_energy]
+    type = KKSLocalFreeEnergy
+    f_name = F
+    c = c
+    eta = eta
+    fa_function = '(0.1-ca)^2'
+    fb_function = '(0.9-cb)^2'
+    w = 0.4
+    outputs = exodus
+  [../]
+
+  # constant properties
+  [./constants]
+    type = GenericConstantMaterial
+    prop_names  = 'M   L   kappa'
+    prop_values = '0.7 0.7 0.4  '
+  [../]
+[]
+
+[Kernels]
+  #
+  # Cahn-Hilliard Equation
+  #
+  [./CHBulk]
+    type = SplitCHParsed
+    variable = c
+    f_name = F
+    kappa_name = 0
+    w = w
+    args = eta
+  [../]
+  [./dcdt]
+    type = CoupledTimeDerivative
+    variable = w
+    v = c
+  [../]
+  [./ckernel]
+    type = SplitCHWRes
+    mob_name = M
+    variable = w
+  [../]
+
+  #
+  # Allen-Cahn Equation
+  #
+  [./ACBulk]
+    type = AllenCahn
+    variable = eta
+    f_name = F
+    args = c
+  [../]
+  [./ACInterface]
+    type = ACInterface
+    variable = eta
+    kappa_name = kappa
+  [../]
+  [./detadt]
+    type = TimeDerivative
+    variable = eta
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  petsc_options_iname = '-pc_factor_shift_type'
+  petsc_options_value = 'nonzero'
+
+  l_max_its = 100
+  nl_max_its = 100
+  num_steps = 3
+
+  dt = 0.1
+[]
+
+[Preconditioning]
+  [./full]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Outputs]
+  exodus = true
+[]
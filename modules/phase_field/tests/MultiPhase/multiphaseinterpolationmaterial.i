@@ -0,0 +1,97 @@
+#
+# This test validates that MultiPhaseInterpolationMaterial generates the same
+# h(eta) switching function and g(eta) double well function material properties
+# as the individual helper materials in orderparameterfunctionmaterial.i
+#
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 40
+  ny = 5
+  nz = 0
+  xmin = 0
+  xmax = 1
+  ymin = 0
+  ymax = 1
+  zmin = 0
+  zmax = 0
+  elem_type = QUAD4
+[]
+
+[BCs]
+  [./left1]
+    type = DirichletBC
+    variable = eta1
+    boundary = 'left'
+    value = 0
+  [../]
+  [./right1]
+    type = DirichletBC
+    variable = eta1
+    boundary = 'right'
+    value = 1
+  [../]
+
+  [./left2]
+    type = DirichletBC
+    variable = eta2
+    boundary = 'left'
+    value = 0
+  [../]
+  [./right2]
+    type = DirichletBC
+    variable = eta2
+    boundary = 'right'
+    value = 1
+  [../]
+[]
+
+[Variables]
+  # order parameter 1
+  [./eta1]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+
+  # order parameter 2
+  [./eta2]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+[]
+
+[Materials]
+  [./interpolation]
+    type = MultiPhaseInterpolationMaterial
+    etas = 'eta1 eta2'
+    h_names = 'h1 h2'
+    h_order = 'SIMPLE HIGH'
+    g_names = 'g1 g2'
+    g_order = 'SIMPLE LOW'
+    outputs = exodus
+  [../]
+[]
+
+[Kernels]
+  [./eta1diff]
+    type = Diffusion
+    variable = eta1
+  [../]
+
+  [./eta2diff]
+    type = Diffusion
+    variable = eta2
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = 'PJFNK'
+[]
+
+[Outputs]
+  file_base = orderparameterfunctionmaterial_out
+  execute_on = 'timestep_end'
+  exodus = true
+[]
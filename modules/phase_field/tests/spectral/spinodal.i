@@ -0,0 +1,77 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 32
+  ny = 32
+  xmax = 32
+  ymax = 32
+[]
+
+[Problem]
+  solve = false
+[]
+
+[Variables]
+  [./dummy]
+  [../]
+[]
+
+[AuxVariables]
+  [./c]
+    [./InitialCondition]
+      type = FunctionIC
+      function = '0.4 + 0.05 * cos(pi * x / 8) * cos(pi * y / 16)'
+    [../]
+  [../]
+[]
+
+[AuxKernels]
+  [./c]
+    type = SpectralSolutionAux
+    variable = c
+    solver = spectral
+  [../]
+[]
+
+[Materials]
+  [./free_energy]
+    type = DerivativeParsedMaterial
+    f_name = F
+    args = c
+    function = 'c^2 * (1 - c)^2'
+  [../]
+[]
+
+[UserObjects]
+  [./spectral]
+    type = SpectralPhaseFieldSolver
+    variable = c
+    equation = cahn_hilliard
+    f_name = F
+    mobility = 1
+    kappa = 1
+    grid = '32 32'
+  [../]
+[]
+
+[Postprocessors]
+  # the semi-implicit spectral scheme conserves the mean concentration exactly
+  [./total_c]
+    type = ElementIntegralVariablePostprocessor
+    variable = c
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 5
+  dt = 1
+  [./Quadrature]
+    type = TRAP
+  [../]
+[]
+
+[Outputs]
+  csv = true
+[]
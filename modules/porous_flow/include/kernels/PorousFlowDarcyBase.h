@@ -121,6 +121,20 @@ protected:
 
   /// Gravity. Defaults to 9.81 m/s^2
   const RealVectorValue _gravity;
+
+  /// grad(P) - density * gravity at each qp for each phase, computed at the start of upwind()
+  std::vector<std::vector<RealVectorValue> > _potential_gradient;
+
+  /// permeability * _potential_gradient at each qp for each phase
+  std::vector<std::vector<RealVectorValue> > _darcy_flux_no_mob;
+
+  ///@{ Storage used by upwind(), kept between calls so it is not reallocated for every element
+  std::vector<std::vector<Real> > _component_re;
+  std::vector<std::vector<std::vector<Real> > > _component_ke;
+  std::vector<Real> _dtotal_mass_out;
+  std::vector<Real> _dtotal_in;
+  std::vector<bool> _upwind_node;
+  ///@}
 };
 
 #endif // POROUSFLOWDARCYBASE_H
@@ -10,6 +10,7 @@
 
 #include "PorousFlowFluidPropertiesBase.h"
 #include "BrineFluidProperties.h"
+#include "PorousFlowNodalCache.h"
 
 class PorousFlowBrine;
 
@@ -30,6 +31,15 @@ protected:
 
   virtual void computeQpProperties();
 
+  /// The number of nodal properties (density, viscosity, internal energy, enthalpy and their derivatives)
+  static const unsigned int N_NODAL_OUTPUTS = 12;
+
+  /// Compute the nodal properties, ordered as in setNodalProperties()
+  void computeNodalProperties(Real pressure, Real Tk, Real xnacl, Real * values) const;
+
+  /// Set the nodal properties at the current qp from values
+  void setNodalProperties(const Real * values);
+
   /// Fluid phase density at the nodes
   MaterialProperty<Real> & _density_nodal;
 
@@ -113,6 +123,12 @@ protected:
 
   /// NaCl mass fraction at the qps
   const VariableValue & _xnacl_qp;
+
+  /// Whether the nodal properties are cached
+  const bool _cache_nodal_properties;
+
+  /// The nodal properties computed from each node's pressure, temperature and NaCl mass fraction
+  PorousFlowNodalCache<3, N_NODAL_OUTPUTS> _nodal_cache;
 };
 
 #endif //POROUSFLOWBRINE_H
@@ -10,6 +10,7 @@
 
 #include "PorousFlowFluidPropertiesBase.h"
 #include "SinglePhaseFluidPropertiesPT.h"
+#include "PorousFlowNodalCache.h"
 
 class PorousFlowSingleComponentFluid;
 
@@ -30,6 +31,15 @@ protected:
   virtual void initQpStatefulProperties();
   virtual void computeQpProperties();
 
+  /// Computes the properties at all qps with one batched call to the fluid properties UserObject per location
+  virtual void computeProperties();
+
+  /// The number of nodal properties (density, viscosity, internal energy, enthalpy and their derivatives)
+  static const unsigned int N_NODAL_OUTPUTS = 12;
+
+  /// Set the nodal properties at qp from values, ordered as in the cache
+  void setNodalProperties(unsigned int qp, const Real * values);
+
   /// Fluid phase density at the nodes
   MaterialProperty<Real> & _density_nodal;
 
@@ -104,6 +114,21 @@ protected:
 
   /// Fluid properties UserObject
   const SinglePhaseFluidPropertiesPT & _fp;
+
+  ///@{ Work arrays for the batched evaluation in computeProperties()
+  std::vector<Real> _batch_pressure;
+  std::vector<Real> _batch_temperature;
+  SinglePhaseFluidPropertiesPT::BatchProperty _batch_rho;
+  SinglePhaseFluidPropertiesPT::BatchProperty _batch_e;
+  SinglePhaseFluidPropertiesPT::BatchProperty _batch_h;
+  std::vector<unsigned int> _batch_qp;
+  ///@}
+
+  /// Whether the nodal properties are cached
+  const bool _cache_nodal_properties;
+
+  /// The nodal properties computed from each node's pressure and temperature
+  PorousFlowNodalCache<2, N_NODAL_OUTPUTS> _nodal_cache;
 };
 
 #endif //POROUSFLOWSINGLECOMPONENTFLUID_H
@@ -0,0 +1,69 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+#ifndef POROUSFLOWNODALCACHE_H
+#define POROUSFLOWNODALCACHE_H
+
+#include "MooseTypes.h"
+
+#include <unordered_map>
+
+/**
+ * Cache of properties computed at the nodes, so that a node shared by
+ * several elements is evaluated once rather than once per element.
+ *
+ * Each entry stores the N_IN inputs (eg, porepressure and temperature)
+ * along with the N_OUT results, and is only used if the inputs match
+ * exactly.  There is therefore no need to invalidate the cache when the
+ * solution changes: an entry is simply recomputed.  Materials are
+ * duplicated for each thread, so each thread has its own cache.
+ */
+template <unsigned int N_IN, unsigned int N_OUT>
+class PorousFlowNodalCache
+{
+public:
+  /**
+   * The cached results for the node
+   * @param node The global id of the node
+   * @param inputs The N_IN inputs the results depend on
+   * @return The N_OUT results, or NULL if the node is not cached with these inputs
+   */
+  const Real * find(dof_id_type node, const Real * inputs) const
+  {
+    typename std::unordered_map<dof_id_type, Entry>::const_iterator it = _entries.find(node);
+    if (it == _entries.end())
+      return NULL;
+    for (unsigned int i = 0; i < N_IN; ++i)
+      if (it->second.inputs[i] != inputs[i])
+        return NULL;
+    return it->second.outputs;
+  }
+
+  /// Store the N_OUT results computed for the node from the N_IN inputs
+  void insert(dof_id_type node, const Real * inputs, const Real * outputs)
+  {
+    Entry & entry = _entries[node];
+    for (unsigned int i = 0; i < N_IN; ++i)
+      entry.inputs[i] = inputs[i];
+    for (unsigned int i = 0; i < N_OUT; ++i)
+      entry.outputs[i] = outputs[i];
+  }
+
+  /// Remove all entries
+  void clear() { _entries.clear(); }
+
+protected:
+  struct Entry
+  {
+    Real inputs[N_IN];
+    Real outputs[N_OUT];
+  };
+
+  std::unordered_map<dof_id_type, Entry> _entries;
+};
+
+#endif //POROUSFLOWNODALCACHE_H
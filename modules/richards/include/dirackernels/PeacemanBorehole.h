@@ -92,6 +92,11 @@ protected:
   /// z points of borehole
   std::vector<Real> _zs;
 
+  ///@{ The Dirac Points and their IDs, as passed to addPointsWithIds()
+  std::vector<Point> _points;
+  std::vector<unsigned> _point_ids;
+  ///@}
+
   /// the bottom point of the borehole (where bottom_pressure is defined)
   Point _bottom_point;
 
@@ -79,6 +79,11 @@ protected:
   /// vector of Dirac Points' z positions
   std::vector<Real> _zs;
 
+  ///@{ The Dirac Points and their IDs, as passed to addPointsWithIds()
+  std::vector<Point> _points;
+  std::vector<unsigned> _point_ids;
+  ///@}
+
   /**
    * reads a space-separated line of floats from ifs and puts in myvec
    * @param ifs the file stream
@@ -108,6 +108,13 @@ protected:
   /// trace of permeability tensor
   Real _trace_perm;
 
+  /**
+   * true if all the SUPG UserObjects are trivial (eg RichardsSUPGnone).
+   * In this case the second derivatives of porepressure, effective saturation
+   * and flux are not computed, as they are only needed for SUPG
+   */
+  bool _trivial_supg;
+
   std::vector<Real> _material_viscosity;
 
 
@@ -0,0 +1,79 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+#ifndef RICHARDSRELPERMTABULATED_H
+#define RICHARDSRELPERMTABULATED_H
+
+#include "RichardsRelPerm.h"
+
+class RichardsRelPermTabulated;
+
+
+template<>
+InputParameters validParams<RichardsRelPermTabulated>();
+
+/**
+ * Tabulates another RichardsRelPerm so that relperm, drelperm and
+ * d2relperm become table lookups.  The relative permeability and its
+ * first and second derivatives are evaluated at equally-spaced effective
+ * saturations, and a quintic Hermite polynomial is used in each interval,
+ * so the tabulated curve and its first two derivatives are continuous and
+ * consistent with each other.  The accuracy of the table is checked when it
+ * is built.  Outside the tabulated range the original RichardsRelPerm is used.
+ */
+class RichardsRelPermTabulated : public RichardsRelPerm
+{
+public:
+  RichardsRelPermTabulated(const InputParameters & parameters);
+
+  /**
+   * relative permeability as a function of effective saturation
+   * @param seff effective saturation
+   */
+  Real relperm(Real seff) const;
+
+  /**
+   * derivative of relative permeability wrt effective saturation
+   * @param seff effective saturation
+   */
+  Real drelperm(Real seff) const;
+
+  /**
+   * second derivative of relative permeability wrt effective saturation
+   * @param seff effective saturation
+   */
+  Real d2relperm(Real seff) const;
+
+protected:
+  /**
+   * The interval containing seff and the position within it
+   * @param seff effective saturation, which must be within the tabulated range
+   * @param t upon return, the position of seff within the interval, between 0 and 1
+   * @return the coefficients of the polynomial in t for the interval
+   */
+  const Real * interval(Real seff, Real & t) const;
+
+  /// the relative permeability that is tabulated
+  const RichardsRelPerm & _relperm;
+
+  /// the lower end of the tabulated range of effective saturation
+  Real _seff_min;
+
+  /// the upper end of the tabulated range of effective saturation
+  Real _seff_max;
+
+  /// number of intervals in the table
+  unsigned int _num_intervals;
+
+  /// width of each interval
+  Real _h;
+
+  /// the 6 polynomial coefficients of each interval, with the polynomials written in terms of the position in the interval
+  std::vector<Real> _coefficients;
+};
+
+#endif // RICHARDSRELPERMTABULATED_H
@@ -19,60 +19,44 @@
 class SymmTensor
 {
 public:
-  SymmTensor() :
-    _xx(0),
-    _yy(0),
-    _zz(0),
-    _xy(0),
-    _yz(0),
-    _zx(0)
-  {}
+  SymmTensor()
+  {
+    zero();
+  }
   explicit
-  SymmTensor(Real init) :
-    _xx(init),
-    _yy(init),
-    _zz(init),
-    _xy(init),
-    _yz(init),
-    _zx(init)
-  {}
-  SymmTensor(Real xx, Real yy, Real zz, Real xy, Real yz, Real zx) :
-    _xx(xx),
-    _yy(yy),
-    _zz(zz),
-    _xy(xy),
-    _yz(yz),
-    _zx(zx)
-  {}
+  SymmTensor(Real init)
+  {
+    *this = init;
+  }
+  SymmTensor(Real xx, Real yy, Real zz, Real xy, Real yz, Real zx)
+  {
+    _t[XX] = xx;
+    _t[YY] = yy;
+    _t[ZZ] = zz;
+    _t[XY] = xy;
+    _t[YZ] = yz;
+    _t[ZX] = zx;
+  }
   explicit
-  SymmTensor(const ColumnMajorMatrix & cmm) :
-    _xx( cmm.numEntries() == 9 ? cmm.rawData()[0] : 0 ),
-    _yy( cmm.numEntries() == 9 ? cmm.rawData()[4] : 0 ),
-    _zz( cmm.numEntries() == 9 ? cmm.rawData()[8] : 0 ),
-    _xy( cmm.numEntries() == 9 ? cmm.rawData()[1] : 0 ),
-    _yz( cmm.numEntries() == 9 ? cmm.rawData()[5] : 0 ),
-    _zx( cmm.numEntries() == 9 ? cmm.rawData()[2] : 0 )
+  SymmTensor(const ColumnMajorMatrix & cmm)
   {
     if (cmm.numEntries() != 9)
     {
       mooseError("Cannot create SymmTensor from ColumnMajorMatrix.  Wrong number of entries.");
     }
+    *this = cmm;
   }
 
   explicit
-  SymmTensor(const std::vector<Real> & init_list) :
-      _xx(init_list[0]),
-      _yy(init_list[1]),
-      _zz(init_list[2]),
-      _xy(init_list[3]),
-      _yz(init_list[4]),
-      _zx(init_list[5])
+  SymmTensor(const std::vector<Real> & init_list)
   {
     // test the length to make sure it's 6 long
     if (init_list.size() != 6)
     {
       mooseError("SymmTensor initialization error: please enter a vector with 6 entries.");
     }
+    for (unsigned int i = 0; i < N; ++i)
+      _t[i] = init_list[i];
   }
 
   void fillFromInputVector(const std::vector<Real> & input)
@@ -81,12 +65,8 @@ public:
     {
       mooseError("SymmTensor error.  Input vector must have six entries.");
     }
-    _xx = input[0];
-    _yy = input[1];
-    _zz = input[2];
-    _xy = input[3];
-    _yz = input[4];
-    _zx = input[5];
+    for (unsigned int i = 0; i < N; ++i)
+      _t[i] = input[i];
   }
 
   Real rowDot(const unsigned int r,
@@ -95,15 +75,15 @@ public:
     mooseAssert(LIBMESH_DIM == 3, "Incompatible sizes");
     if (0 == r)
     {
-      return _xx * v(0) + _xy * v(1) + _zx * v(2);
+      return _t[XX] * v(0) + _t[XY] * v(1) + _t[ZX] * v(2);
     }
     else if (1 == r)
     {
-      return _xy * v(0) + _yy * v(1) + _yz * v(2);
+      return _t[XY] * v(0) + _t[YY] * v(1) + _t[YZ] * v(2);
     }
     else if (2 == r)
     {
-      return _zx * v(0) + _yz * v(1) + _zz * v(2);
+      return _t[ZX] * v(0) + _t[YZ] * v(1) + _t[ZZ] * v(2);
     }
     else
     {
@@ -114,112 +94,88 @@ public:
 
   Real trace() const
   {
-    return _xx + _yy + _zz;
+    return _t[XX] + _t[YY] + _t[ZZ];
   }
 
   Real component( unsigned int i ) const
   {
-    if (0 == i)
-    {
-      return _xx;
-    }
-    else if (1 == i)
-    {
-      return _yy;
-    }
-    else if (2 == i)
-    {
-      return _zz;
-    }
-    else if (3 == i)
-    {
-      return _xy;
-    }
-    else if (4 == i)
-    {
-      return _yz;
-    }
-    else if (5 == i)
-    {
-      return _zx;
-    }
-    else
+    if (i >= N)
     {
       mooseError( "Invalid entry requested for SymmTensor" );
     }
-    return 0;
+    return _t[i];
   }
   Real xx() const
   {
-    return _xx;
+    return _t[XX];
   }
   Real yy() const
   {
-    return _yy;
+    return _t[YY];
   }
   Real zz() const
   {
-    return _zz;
+    return _t[ZZ];
   }
   Real xy() const
   {
-    return _xy;
+    return _t[XY];
   }
   Real yz() const
   {
-    return _yz;
+    return _t[YZ];
   }
   Real zx() const
   {
-    return _zx;
+    return _t[ZX];
   }
   Real yx() const
   {
-    return _xy;
+    return _t[XY];
   }
   Real zy() const
   {
-    return _yz;
+    return _t[YZ];
   }
   Real xz() const
   {
-    return _zx;
+    return _t[ZX];
   }
   Real & xx()
   {
-    return _xx;
+    return _t[XX];
   }
   Real & yy()
   {
-    return _yy;
+    return _t[YY];
   }
   Real & zz()
   {
-    return _zz;
+    return _t[ZZ];
   }
   Real & xy()
   {
-    return _xy;
+    return _t[XY];
   }
   Real & yz()
   {
-    return _yz;
+    return _t[YZ];
   }
   Real & zx()
   {
-    return _zx;
+    return _t[ZX];
   }
   Real & yx()
   {
-    return _xy;
+    return _t[XY];
   }
   Real & zy()
   {
-    return _yz;
+    return _t[YZ];
   }
   Real & xz()
   {
-    return _zx;
+    return _t[ZX];
   }
   Real & operator()(const unsigned i, const unsigned j)
   {
@@ -228,45 +184,45 @@ public:
     {
       if (0 == j)
       {
-        rVal = &_xx;
+        rVal = &_t[XX];
       }
       else if (1 == j)
       {
-        rVal = &_xy;
+        rVal = &_t[XY];
       }
       else if (2 == j)
       {
-        rVal = &_zx;
+        rVal = &_t[ZX];
       }
     }
     else if (1 == i)
     {
       if (0 == j)
       {
-        rVal = &_xy;
+        rVal = &_t[XY];
       }
       else if (1 == j)
       {
-        rVal = &_yy;
+        rVal = &_t[YY];
       }
       else if (2 == j)
       {
-        rVal = &_yz;
+        rVal = &_t[YZ];
       }
     }
     else if (2 == i)
     {
       if (0 == j)
       {
-        rVal = &_zx;
+        rVal = &_t[ZX];
       }
       else if (1 == j)
       {
-        rVal = &_yz;
+        rVal = &_t[YZ];
       }
       else if (2 == j)
       {
-        rVal = &_zz;
+        rVal = &_t[ZZ];
       }
     }
     if (!rVal)
@@ -283,45 +239,45 @@ public:
     {
       if (0 == j)
       {
-        rVal = &_xx;
+        rVal = &_t[XX];
       }
       else if (1 == j)
       {
-        rVal = &_xy;
+        rVal = &_t[XY];
       }
       else if (2 == j)
       {
-        rVal = &_zx;
+        rVal = &_t[ZX];
       }
     }
     else if (1 == i)
     {
       if (0 == j)
       {
-        rVal = &_xy;
+        rVal = &_t[XY];
       }
       else if (1 == j)
       {
-        rVal = &_yy;
+        rVal = &_t[YY];
       }
       else if (2 == j)
       {
-        rVal = &_yz;
+        rVal = &_t[YZ];
       }
     }
     else if (2 == i)
     {
       if (0 == j)
       {
-        rVal = &_zx;
+        rVal = &_t[ZX];
       }
       else if (1 == j)
       {
-        rVal = &_yz;
+        rVal = &_t[YZ];
       }
       else if (2 == j)
       {
-        rVal = &_zz;
+        rVal = &_t[ZZ];
       }
     }
     if (!rVal)
@@ -333,74 +289,72 @@ public:
 
   Real doubleContraction( const SymmTensor & rhs ) const
   {
-    return _xx*rhs._xx + _yy*rhs._yy + _zz*rhs._zz +
-      2*(_xy*rhs._xy + _yz*rhs._yz + _zx*rhs._zx);
+    return _t[XX]*rhs._t[XX] + _t[YY]*rhs._t[YY] + _t[ZZ]*rhs._t[ZZ] +
+      2*(_t[XY]*rhs._t[XY] + _t[YZ]*rhs._t[YZ] + _t[ZX]*rhs._t[ZX]);
   }
 
 
 
   void xx( Real xx )
   {
-    _xx = xx;
+    _t[XX] = xx;
   }
   void yy( Real yy )
   {
-    _yy = yy;
+    _t[YY] = yy;
   }
   void zz( Real zz )
   {
-    _zz = zz;
+    _t[ZZ] = zz;
   }
   void xy( Real xy )
   {
-    _xy = xy;
+    _t[XY] = xy;
   }
   void yz( Real yz )
   {
-    _yz = yz;
+    _t[YZ] = yz;
   }
   void zx( Real zx )
   {
-    _zx = zx;
+    _t[ZX] = zx;
   }
   void yx( Real yx )
   {
-    _xy = yx;
+    _t[XY] = yx;
   }
   void zy( Real zy )
   {
-    _yz = zy;
+    _t[YZ] = zy;
   }
   void xz( Real xz )
   {
-    _zx = xz;
+    _t[ZX] = xz;
   }
 
 
   void zero()
   {
-    _xx = _yy = _zz = _xy = _yz = _zx = 0;
+    for (unsigned int i = 0; i < N; ++i)
+      _t[i] = 0;
   }
   void identity()
   {
-    _xx = _yy = _zz = 1;
-    _xy = _yz = _zx = 0;
+    _t[XX] = _t[YY] = _t[ZZ] = 1;
+    _t[XY] = _t[YZ] = _t[ZX] = 0;
   }
   void addDiag( Real value )
   {
-    _xx += value;
-    _yy += value;
-    _zz += value;
+    _t[XX] += value;
+    _t[YY] += value;
+    _t[ZZ] += value;
   }
   bool operator==(const SymmTensor & rhs) const
   {
-    return
-      _xx == rhs._xx &&
-      _yy == rhs._yy &&
-      _zz == rhs._zz &&
-      _xy == rhs._xy &&
-      _yz == rhs._yz &&
-      _zx == rhs._zx;
+    for (unsigned int i = 0; i < N; ++i)
+      if (_t[i] != rhs._t[i])
+        return false;
+    return true;
   }
   bool operator!=(const SymmTensor & rhs) const
   {
@@ -409,35 +363,23 @@ public:
 
   SymmTensor & operator+=(const SymmTensor & t)
   {
-    _xx += t._xx;
-    _yy += t._yy;
-    _zz += t._zz;
-    _xy += t._xy;
-    _yz += t._yz;
-    _zx += t._zx;
+    for (unsigned int i = 0; i < N; ++i)
+      _t[i] += t._t[i];
     return *this;
   }
 
   SymmTensor & operator-=(const SymmTensor & t)
   {
-    _xx -= t._xx;
-    _yy -= t._yy;
-    _zz -= t._zz;
-    _xy -= t._xy;
-    _yz -= t._yz;
-    _zx -= t._zx;
+    for (unsigned int i = 0; i < N; ++i)
+      _t[i] -= t._t[i];
     return *this;
   }
 
   SymmTensor operator+(const SymmTensor & t) const
   {
     SymmTensor r_val;
-    r_val._xx = _xx + t._xx;
-    r_val._yy = _yy + t._yy;
-    r_val._zz = _zz + t._zz;
-    r_val._xy = _xy + t._xy;
-    r_val._yz = _yz + t._yz;
-    r_val._zx = _zx + t._zx;
+    for (unsigned int i = 0; i < N; ++i)
+      r_val._t[i] = _t[i] + t._t[i];
     return r_val;
   }
 
@@ -445,31 +387,23 @@ public:
   {
     SymmTensor r_val;
 
-    r_val._xx = _xx * t;
-    r_val._yy = _yy * t;
-    r_val._zz = _zz * t;
-    r_val._xy = _xy * t;
-    r_val._yz = _yz * t;
-    r_val._zx = _zx * t;
+    for (unsigned int i = 0; i < N; ++i)
+      r_val._t[i] = _t[i] * t;
     return r_val;
   }
 
   Point operator*(const Point & p) const
   {
-    return Point(_xx*p(0) + _xy*p(1) + _zx*p(2),
-                 _xy*p(0) + _yy*p(1) + _yz*p(2),
-                 _zx*p(0) + _yz*p(1) + _zz*p(2));
+    return Point(_t[XX]*p(0) + _t[XY]*p(1) + _t[ZX]*p(2),
+                 _t[XY]*p(0) + _t[YY]*p(1) + _t[YZ]*p(2),
+                 _t[ZX]*p(0) + _t[YZ]*p(1) + _t[ZZ]*p(2));
   }
 
   SymmTensor operator-(const SymmTensor & t) const
   {
     SymmTensor r_val;
-    r_val._xx = _xx - t._xx;
-    r_val._yy = _yy - t._yy;
-    r_val._zz = _zz - t._zz;
-    r_val._xy = _xy - t._xy;
-    r_val._yz = _yz - t._yz;
-    r_val._zx = _zx - t._zx;
+    for (unsigned int i = 0; i < N; ++i)
+      r_val._t[i] = _t[i] - t._t[i];
     return r_val;
   }
 
@@ -477,12 +411,12 @@ public:
   {
     mooseAssert(cmm.numEntries() == 9, "Cannot add ColumnMajorMatrix to SymmTensor.  Wrong number of entries.");
     const Real * data = cmm.rawData();
-    _xx += data[0];
-    _xy += data[1];
-    _zx += data[2];
-    _yy += data[4];
-    _yz += data[5];
-    _zz += data[8];
+    _t[XX] += data[0];
+    _t[XY] += data[1];
+    _t[ZX] += data[2];
+    _t[YY] += data[4];
+    _t[YZ] += data[5];
+    _t[ZZ] += data[8];
     return *this;
   }
 
@@ -491,12 +425,12 @@ public:
     mooseAssert(cmm.numEntries() == 9, "Cannot add ColumnMajorMatrix to SymmTensor.  Wrong number of entries.");
     const Real * data = cmm.rawData();
 
-    _xx -= data[0];
-    _xy -= data[1];
-    _zx -= data[2];
-    _yy -= data[4];
-    _yz -= data[5];
-    _zz -= data[8];
+    _t[XX] -= data[0];
+    _t[XY] -= data[1];
+    _t[ZX] -= data[2];
+    _t[YY] -= data[4];
+    _t[YZ] -= data[5];
+    _t[ZZ] -= data[8];
     return *this;
   }
 
@@ -504,49 +438,41 @@ public:
   {
     mooseAssert(cmm.numEntries() == 9, "Cannot set SymmTensor to ColumnMajorMatrix.  Wrong number of entries.");
     const Real * data = cmm.rawData();
-    _xx = data[0];
-    _xy = data[1];
-    _zx = data[2];
-    _yy = data[4];
-    _yz = data[5];
-    _zz = data[8];
+    _t[XX] = data[0];
+    _t[XY] = data[1];
+    _t[ZX] = data[2];
+    _t[YY] = data[4];
+    _t[YZ] = data[5];
+    _t[ZZ] = data[8];
     return *this;
   }
 
   SymmTensor & operator=(Real val)
   {
-    _xx = val;
-    _xy = val;
-    _zx = val;
-    _yy = val;
-    _yz = val;
-    _zz = val;
+    for (unsigned int i = 0; i < N; ++i)
+      _t[i] = val;
     return *this;
   }
 
   SymmTensor & operator*=(Real val)
   {
-    _xx *= val;
-    _xy *= val;
-    _zx *= val;
-    _yy *= val;
-    _yz *= val;
-    _zz *= val;
+    for (unsigned int i = 0; i < N; ++i)
+      _t[i] *= val;
     return *this;
   }
 
   ColumnMajorMatrix columnMajorMatrix() const
   {
     ColumnMajorMatrix cmm(3, 3);
-    cmm(0,0) = _xx;
-    cmm(1,0) = _xy;
-    cmm(2,0) = _zx;
-    cmm(0,1) = _xy;
-    cmm(1,1) = _yy;
-    cmm(2,1) = _yz;
-    cmm(0,2) = _zx;
-    cmm(1,2) = _yz;
-    cmm(2,2) = _zz;
+    cmm(0,0) = _t[XX];
+    cmm(1,0) = _t[XY];
+    cmm(2,0) = _t[ZX];
+    cmm(0,1) = _t[XY];
+    cmm(1,1) = _t[YY];
+    cmm(2,1) = _t[YZ];
+    cmm(0,2) = _t[ZX];
+    cmm(1,2) = _t[YZ];
+    cmm(2,2) = _t[ZZ];
     return cmm;
   }
 
@@ -578,13 +504,18 @@ public:
 
   }
 
+  /// The components xx, yy, zz, xy, yz, zx, packed so the component-wise operations vectorize
+  const Real * rawData() const { return _t; }
+  Real * rawData() { return _t; }
+
 private:
-  Real _xx;
-  Real _yy;
-  Real _zz;
-  Real _xy;
-  Real _yz;
-  Real _zx;
+  /// The number of components
+  static const unsigned int N = 6;
+
+  /// The positions of the components in the packed storage
+  enum { XX, YY, ZZ, XY, YZ, ZX };
+
+  Real _t[N];
 };
 
 template <>
@@ -44,7 +44,10 @@ protected:
   int  _NDI, _NSHR, _NTENS, _NSTATV, _NPROPS, _NOEL, _NPT, _LAYER, _KSPT, _KSTEP, _KINC;
 
   //UMAT arrays
-  Real * _STATEV,  * _DDSDDT, * _DRPLDE, * _STRAN, _PREDEF[1], _DPRED[1], _COORDS[3], _DROT[3][3], * _DFGRD0, * _DFGRD1, * _STRESS, * _DDSDDE, * _DSTRAN, _TIME[2], * _PROPS;
+  Real _PREDEF[1], _DPRED[1], _COORDS[3], _DROT[3][3], _TIME[2];
+
+  //UMAT scratch arrays, sized in the constructor (one set per thread copy of the material)
+  std::vector<Real> _STATEV, _DDSDDT, _DRPLDE, _STRAN, _DFGRD0, _DFGRD1, _STRESS, _DDSDDE, _DSTRAN, _PROPS;
 
   virtual void initQpStatefulProperties();
   virtual void computeStress();
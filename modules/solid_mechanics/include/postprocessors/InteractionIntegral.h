@@ -27,9 +27,12 @@ public:
   InteractionIntegral(const InputParameters & parameters);
 
   virtual Real getValue();
+  /// getValue() modifies the reduced integral, so it can only be called once
+  virtual bool deferReduction() const { return false; }
 
 protected:
   virtual void initialSetup();
+  virtual Real computeIntegral();
   virtual Real computeQpIntegral();
   const VariableValue & _scalar_q;
   /// The gradient of the scalar q field
@@ -54,6 +57,8 @@ protected:
   bool _has_symmetry_plane;
   bool _t_stress;
   Real _poissons_ratio;
+  /// Average length of the crack front segments adjacent to the point, set for each element
+  Real _q_avg_seg;
 };
 
 #endif //INTERACTIONINTEGRAL_H
@@ -25,9 +25,12 @@ class JIntegral: public ElementIntegralPostprocessor
 public:
   JIntegral(const InputParameters & parameters);
   virtual Real getValue();
+  /// getValue() modifies the reduced integral, so it can only be called once
+  virtual bool deferReduction() const { return false; }
 
 protected:
   virtual void initialSetup();
+  virtual Real computeIntegral();
   virtual Real computeQpIntegral();
   const VariableValue & _scalar_q;
   /// The gradient of the scalar q field
@@ -42,6 +45,8 @@ protected:
   bool _has_symmetry_plane;
   Real _poissons_ratio;
   Real _youngs_modulus;
+  /// Average length of the crack front segments adjacent to the point, set for each element
+  Real _q_avg_seg;
 };
 
 #endif //JINTEGRAL3D_H
@@ -0,0 +1,54 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef HEXHOURGLASSSTABILIZATION_H
+#define HEXHOURGLASSSTABILIZATION_H
+
+#include "Kernel.h"
+
+class HexHourglassStabilization;
+
+template<>
+InputParameters validParams<HexHourglassStabilization>();
+
+/**
+ * HexHourglassStabilization adds the Flanagan-Belytschko stiffness hourglass
+ * control to one displacement component of HEX8 elements integrated with a
+ * single qp (Quadrature order = CONSTANT).  The one-point rule does not see
+ * the four hourglass modes of the element; this kernel resists them with
+ *   R_a = k sum_alpha gamma_a^alpha q^alpha,   q^alpha = sum_b gamma_b^alpha u_b
+ * where gamma^alpha are the hourglass base vectors made orthogonal to the
+ * linear displacement fields, and k = coefficient 2 G V sum_a |grad N_a|^2 / 3.
+ * The modes of each component are independent, so there is no off-diagonal Jacobian.
+ */
+class HexHourglassStabilization : public Kernel
+{
+public:
+  HexHourglassStabilization(const InputParameters & parameters);
+
+  virtual void computeResidual();
+  virtual void computeJacobian();
+
+protected:
+  virtual Real computeQpResidual() { return 0.0; }
+
+  /// Compute the hourglass shape vectors _gamma and the stiffness _k for the current element
+  void computeHourglassVectors();
+
+  /// Nodal values of the displacement component
+  const VariableValue & _u_nodal;
+
+  const Real _shear_modulus;
+  const Real _coefficient;
+
+  /// Hourglass shape vectors, [mode][node]
+  Real _gamma[4][8];
+
+  /// Hourglass stiffness of the current element
+  Real _k;
+};
+
+#endif //HEXHOURGLASSSTABILIZATION_H
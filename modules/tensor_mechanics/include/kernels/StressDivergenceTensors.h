@@ -39,6 +39,13 @@ protected:
 
   virtual void computeFiniteDeformJacobian();
 
+  /// The small deformation Jacobian blocks of the displacements are C_{component j k l} grad_phi_l grad_test_j
+  virtual bool hasJacobianCoefficients(unsigned int jvar);
+  virtual void computeQpJacobianCoefficients(unsigned int jvar, RealTensorValue & D, RealVectorValue & b, Real & c);
+
+  /// The displacement component of the variable jvar, or _ndisp if jvar is not a displacement
+  unsigned int displacementComponent(unsigned int jvar) const;
+
   std::string _base_name;
   bool _use_finite_deform_jacobian;
 
@@ -9,6 +9,7 @@
 
 #include "Material.h"
 #include "RankFourTensor.h"
+#include "SymmetricRankFourTensor.h"
 
 /**
  * ComputeElasticityTensorBase the base class for computing elasticity tensors
@@ -27,6 +28,9 @@ protected:
 
   MaterialProperty<RankFourTensor> & _elasticity_tensor;
 
+  /// Compressed (Mandel) copy of the elasticity tensor, only declared if requested
+  MaterialProperty<SymmetricRankFourTensor> * _symmetric_elasticity_tensor;
+
   /// prefactor function to multiply the elasticity tensor with
   Function * const _prefactor_function;
 };
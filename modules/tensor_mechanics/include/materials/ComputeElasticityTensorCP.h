@@ -38,6 +38,21 @@ protected:
 
   /// Rotation matrix
   RotationTensor _R;
+
+  /**
+   * The rotation of _Cijkl is only recomputed when the Euler angles differ
+   * from those of the previous qp, i.e. once per grain or element.
+   */
+  bool _rotation_cached;
+
+  /// Euler angles of the cached rotation
+  RealVectorValue _cached_Euler_angles;
+
+  /// Crystal rotation for _cached_Euler_angles
+  RankTwoTensor _cached_crysrot;
+
+  /// Elasticity tensor rotated by _cached_crysrot
+  RankFourTensor _cached_Cijkl;
 };
 
 #endif //COMPUTEELASTICITYTENSORCP_H
@@ -30,7 +30,8 @@ private:
   enum class DecompMethod
   {
     TaylorExpansion,
-    EigenSolution
+    EigenSolution,
+    ClosedForm
   };
 
   const DecompMethod _decomposition_method;
@@ -8,6 +8,7 @@
 #define COMPUTEFINITESTRAINELASTICSTRESS_H
 
 #include "ComputeStressBase.h"
+#include "SymmetricRankFourTensor.h"
 
 /**
  * ComputeFiniteStrainElasticStress computes the stress following elasticity
@@ -20,10 +21,14 @@ public:
 
 protected:
   virtual void computeQpStress();
+  virtual void computeStresses();
 
   const MaterialProperty<RankTwoTensor> & _strain_increment;
   const MaterialProperty<RankTwoTensor> & _rotation_increment;
   MaterialProperty<RankTwoTensor> & _stress_old;
+
+  /// Compressed elasticity tensor used for the stress contraction (optional)
+  const MaterialProperty<SymmetricRankFourTensor> * _symmetric_elasticity_tensor;
 };
 
 #endif //COMPUTEFINITESTRAINELASTICSTRESS_H
@@ -8,6 +8,7 @@
 #define COMPUTELINEARELASTICSTRESS_H
 
 #include "ComputeStressBase.h"
+#include "SymmetricRankFourTensor.h"
 
 /**
  * ComputeLinearElasticStress computes the stress following linear elasticity theory (small strains)
@@ -20,8 +21,12 @@ public:
 
 protected:
   virtual void computeQpStress();
+  virtual void computeStresses();
 
   const MaterialProperty<RankTwoTensor> & _mechanical_strain;
+
+  /// Compressed elasticity tensor used for the stress contraction (optional)
+  const MaterialProperty<SymmetricRankFourTensor> * _symmetric_elasticity_tensor;
 };
 
 #endif //COMPUTELINEARELASTICSTRESS_H
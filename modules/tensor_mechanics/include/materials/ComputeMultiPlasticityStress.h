@@ -169,6 +169,52 @@ protected:
   /// Curvature that can be rotated by this class, and split into multiple increments (ie, its not const)
   RankTwoTensor _my_curvature;
 
+  /**
+   * Scratch storage used by plasticStep, returnMap, singleStep, lineSearch
+   * and their helpers.  Storage is reserved in the constructor (the sizes are
+   * bounded by the number of surfaces and models) and re-used at every quadpoint,
+   * so the Newton-Raphson process does not allocate.  Each function has its own
+   * entries so that nested calls never overwrite their caller's data.
+   * Materials are duplicated for each thread, so this needs no locking.
+   */
+  struct ReturnMapWorkspace
+  {
+    /// reserve all storage for the given number of surfaces and models
+    void reserve(unsigned int num_surfaces, unsigned int num_models);
+
+    /// plasticStep: the latest admissible internal parameters and yield functions
+    std::vector<Real> intnl_good;
+    std::vector<Real> yf_good;
+
+    /// returnMap: plastic multipliers, internal constraints and active sets
+    std::vector<Real> pm;
+    std::vector<Real> ic;
+    std::vector<bool> act;
+    std::vector<bool> initial_act;
+    std::vector<bool> act_plus;
+    std::vector<unsigned int> dumb_order;
+    std::vector<Real> all_f;
+
+    /// singleStep: the quantities recorded before the step, and the Newton-Raphson updates
+    std::vector<Real> intnl_before_step;
+    std::vector<Real> pm_before_step;
+    std::vector<Real> dpm;
+    std::vector<Real> dintnl;
+    std::vector<bool> deact_ld;
+
+    /// lineSearch: the trial quantities and flow directions
+    std::vector<Real> ls_pm;
+    std::vector<Real> ls_intnl;
+    std::vector<RankTwoTensor> r;
+
+    /// residual2 and checkAdmissible
+    std::vector<bool> active_not_deact;
+    std::vector<bool> all_act;
+  };
+
+  /// Scratch storage for the return-map algorithm
+  ReturnMapWorkspace _work;
+
 
 
   /**
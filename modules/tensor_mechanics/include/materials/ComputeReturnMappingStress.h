@@ -35,6 +35,7 @@ protected:
   virtual void initialSetup();
 
   virtual void computeQpStress();
+  virtual void computeStresses();
 
   /// Calls all of the user-specified radial recompute materials and iterates
   /// over the change in the effective radial return stress.
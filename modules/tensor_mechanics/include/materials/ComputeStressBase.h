@@ -23,9 +23,20 @@ public:
 
 protected:
   virtual void initQpStatefulProperties();
+  virtual void computeProperties();
   virtual void computeQpProperties();
   virtual void computeQpStress() = 0;
 
+  /**
+   * Compute the stress, elastic strain and Jacobian at all the quadrature
+   * points of the element, including the extra stress.  The default calls
+   * computeQpProperties() at each qp; stress calculators with a simple update
+   * override this to work through the property arrays in a single loop.
+   * Classes derived from such a calculator that override computeQpStress()
+   * must call ComputeStressBase::computeStresses() from their own override.
+   */
+  virtual void computeStresses();
+
   std::string _base_name;
 
   const MaterialProperty<RankTwoTensor> & _mechanical_strain;
@@ -21,6 +21,7 @@ public:
 
 protected:
   virtual void computeQpStress();
+  virtual void computeStresses();
 
   /// The old elasticity tensor is required to recover the old strain state from the old stress
   const MaterialProperty<RankFourTensor> & _elasticity_tensor_old;
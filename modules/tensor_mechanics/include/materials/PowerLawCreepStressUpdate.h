@@ -36,6 +36,7 @@ protected:
 
   virtual Real computeResidual(Real effectiveTrialStress, Real scalar);
   virtual Real computeDerivative(Real effectiveTrialStress, Real scalar);
+  virtual void computeResidualAndDerivative(Real effectiveTrialStress, Real scalar, Real & residual, Real & derivative);
 
   const Real _coefficient;
   const Real _n_exponent;
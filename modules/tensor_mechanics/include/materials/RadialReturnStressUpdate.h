@@ -44,6 +44,14 @@ protected:
   virtual void iterationInitialize(Real /*scalar*/) {}
   virtual Real computeResidual(Real /*effectiveTrialStress*/, Real /*scalar*/) {return 0;}
   virtual Real computeDerivative(Real /*effectiveTrialStress*/, Real /*scalar*/) {return 0;}
+
+  /**
+   * Compute the residual and its derivative for one Newton iteration.  The default calls
+   * computeResidual() and computeDerivative(); models whose residual and derivative share
+   * expensive terms (e.g. a power of the stress) override this to evaluate them once.
+   */
+  virtual void computeResidualAndDerivative(Real effectiveTrialStress, Real scalar, Real & residual, Real & derivative);
+
   virtual void iterationFinalize(Real /*scalar*/) {}
   virtual void computeStressFinalize(const RankTwoTensor & /*inelasticStrainIncrement*/) {}
   virtual Real getIsotropicShearModulus();
@@ -9,6 +9,8 @@
 
 #include "GeneralUserObject.h"
 
+class KDTree;
+
 /**
  * Read properties from file - grain or element
  * Input file syntax: prop1 prop2 etc. See test.
@@ -26,7 +28,7 @@ class ElementPropertyReadFile : public GeneralUserObject
 {
  public:
   ElementPropertyReadFile(const InputParameters & parameters);
-  virtual ~ElementPropertyReadFile() {}
+  virtual ~ElementPropertyReadFile();
 
   virtual void initialize() {}
   virtual void execute() {}
@@ -48,6 +50,11 @@ class ElementPropertyReadFile : public GeneralUserObject
    */
   virtual void initGrainCenterPoints();
 
+  /**
+   * This function reads nrows rows of property data from the text or binary file
+   */
+  void readData(unsigned int nrows);
+
   /**
    * This function assign property data to elements
    */
@@ -91,6 +98,21 @@ class ElementPropertyReadFile : public GeneralUserObject
   MooseMesh & _mesh;
   std::vector<Point> _center;
 
+  ///Search tree over the grain centers
+  MooseSharedPointer<KDTree> _center_tree;
+
+  ///Whether the property file is binary (memory mapped) rather than text
+  const bool _binary;
+
+  ///Property values: points into _data (text file) or into the mapped binary file
+  const Real * _values;
+
+  ///The mapped binary file, NULL for a text file
+  void * _mapped_file;
+
+  ///Size of the mapping in bytes
+  std::size_t _mapped_size;
+
  private:
   unsigned int _nelem;
   Point _top_right;
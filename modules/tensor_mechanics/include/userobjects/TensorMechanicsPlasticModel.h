@@ -98,6 +98,22 @@ class TensorMechanicsPlasticModel : public GeneralUserObject
    */
   virtual void dflowPotential_dintnlV(const RankTwoTensor & stress, Real intnl, std::vector<RankTwoTensor> & dr_dintnl) const;
 
+  /**
+   * The derivatives of the yield functions, the flow potentials and their derivatives, which
+   * are the quantities needed by the Newton-Raphson Jacobian, in one call.  The default calls
+   * the functions above.  Override this if these quantities share an expensive computation
+   * (the eigenvalues of the stress, for instance), keeping the order in which the functions
+   * above draw random numbers, if they do.
+   * @param stress the stress at which to calculate the quantities
+   * @param intnl internal parameter
+   * @param[out] df_dstress df_dstress[alpha](i, j) = dyieldFunction[alpha]/dstress(i, j)
+   * @param[out] df_dintnl df_dintnl[alpha] = df[alpha]/dintnl
+   * @param[out] r r[alpha] is the flow potential for the "alpha" yield function
+   * @param[out] dr_dstress dr_dstress[alpha](i, j, k, l) = dr[alpha](i, j)/dstress(k, l)
+   * @param[out] dr_dintnl dr_dintnl[alpha](i, j) = dr[alpha](i, j)/dintnl
+   */
+  virtual void computeAllQuantitiesV(const RankTwoTensor & stress, Real intnl, std::vector<RankTwoTensor> & df_dstress, std::vector<Real> & df_dintnl, std::vector<RankTwoTensor> & r, std::vector<RankFourTensor> & dr_dstress, std::vector<RankTwoTensor> & dr_dintnl) const;
+
   /**
    * The hardening potential
    * @param stress the stress at which to calculate the hardening potential
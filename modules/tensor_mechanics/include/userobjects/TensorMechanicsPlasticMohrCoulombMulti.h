@@ -39,6 +39,9 @@ class TensorMechanicsPlasticMohrCoulombMulti : public TensorMechanicsPlasticMode
 
   virtual void dflowPotential_dintnlV(const RankTwoTensor & stress, Real intnl, std::vector<RankTwoTensor> & dr_dintnl) const override;
 
+  /// The eigenvalues of the stress and their derivatives are computed once for all the quantities
+  virtual void computeAllQuantitiesV(const RankTwoTensor & stress, Real intnl, std::vector<RankTwoTensor> & df_dstress, std::vector<Real> & df_dintnl, std::vector<RankTwoTensor> & r, std::vector<RankFourTensor> & dr_dstress, std::vector<RankTwoTensor> & dr_dintnl) const override;
+
   virtual void activeConstraints(const std::vector<Real> & f, const RankTwoTensor & stress, Real intnl, const RankFourTensor & Eijkl, std::vector<bool> & act, RankTwoTensor & returned_stress) const override;
 
   virtual std::string modelName() const override;
@@ -108,6 +111,36 @@ class TensorMechanicsPlasticMohrCoulombMulti : public TensorMechanicsPlasticMode
    */
   void df_dsig(const RankTwoTensor & stress, Real sin_angle, std::vector<RankTwoTensor> & df) const;
 
+  /**
+   * df_dsig given the eigenvalues of stress and their derivatives, which are perturbed
+   * (on a copy) in the case of almost-equal eigenvalues
+   * @param stress the stress
+   * @param eigvals the eigenvalues of stress
+   * @param deigvals d(eigenvalues)/dstress_ij
+   * @param sin_angle sin(phi) or sin(psi)
+   * @param[out] df the derivatives
+   */
+  void df_dsigEigvals(const RankTwoTensor & stress, std::vector<Real> eigvals, std::vector<RankTwoTensor> deigvals, Real sin_angle, std::vector<RankTwoTensor> & df) const;
+
+  /**
+   * dflowPotential_dstress given the second derivatives of the eigenvalues of stress
+   * @param d2eigvals d^2(eigenvalues)/dstress_ij/dstress_kl
+   * @param sinpsi sin(dilation angle)
+   * @param[out] dr_dstress the derivatives
+   */
+  void dr_dsigEigvals(const std::vector<RankFourTensor> & d2eigvals, Real sinpsi, std::vector<RankFourTensor> & dr_dstress) const;
+
+  /**
+   * dflowPotential_dintnl given the eigenvalues of stress and their derivatives, which are
+   * perturbed (on a copy) in the case of almost-equal eigenvalues
+   * @param stress the stress
+   * @param eigvals the eigenvalues of stress
+   * @param deigvals d(eigenvalues)/dstress_ij
+   * @param dsin_angle d(sin(psi))/dintnl
+   * @param[out] dr_dintnl the derivatives
+   */
+  void dr_dintnlEigvals(const RankTwoTensor & stress, std::vector<Real> eigvals, std::vector<RankTwoTensor> deigvals, Real dsin_angle, std::vector<RankTwoTensor> & dr_dintnl) const;
+
   /**
    * perturbs the stress tensor in the case of almost-equal eigenvalues.
    * Note that, upon entry, this algorithm assumes that eigvals are the eigvenvalues of stress
@@ -38,6 +38,9 @@ class TensorMechanicsPlasticTensileMulti : public TensorMechanicsPlasticModel
 
   virtual void dflowPotential_dintnlV(const RankTwoTensor & stress, Real intnl, std::vector<RankTwoTensor> & dr_dintnl) const override;
 
+  /// The eigenvalues of the stress and their derivatives are computed once for all the quantities
+  virtual void computeAllQuantitiesV(const RankTwoTensor & stress, Real intnl, std::vector<RankTwoTensor> & df_dstress, std::vector<Real> & df_dintnl, std::vector<RankTwoTensor> & r, std::vector<RankFourTensor> & dr_dstress, std::vector<RankTwoTensor> & dr_dintnl) const override;
+
   virtual void activeConstraints(const std::vector<Real> & f, const RankTwoTensor & stress,
                                  Real intnl, const RankFourTensor & Eijkl, std::vector<bool> & act,
                                  RankTwoTensor & returned_stress) const override;
@@ -58,6 +61,14 @@ class TensorMechanicsPlasticTensileMulti : public TensorMechanicsPlasticModel
 
  protected:
 
+  /**
+   * The derivatives of the eigenvalues of stress, perturbed in the case of almost-equal eigenvalues
+   * @param stress the stress
+   * @param eigvals the eigenvalues of stress
+   * @param[in,out] deigvals d(eigenvalues)/dstress_ij of stress on entry, after perturbing on exit
+   */
+  void perturbedDeigvals(const RankTwoTensor & stress, std::vector<Real> eigvals, std::vector<RankTwoTensor> & deigvals) const;
+
   /// tensile strength as a function of residual value, rate, and internal_param
   virtual Real tensile_strength(const Real internal_param) const;
 
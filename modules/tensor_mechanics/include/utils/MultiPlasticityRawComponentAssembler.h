@@ -149,6 +149,23 @@ protected:
    */
   virtual void dhardPotential_dintnl(const RankTwoTensor & stress, const std::vector<Real> & intnl, const std::vector<bool> & active, std::vector<Real> & dh_dintnl);
 
+  /**
+   * The derivatives of the active yield functions, the active flow potentials and their derivatives
+   * with one call to TensorMechanicsPlasticModel::computeAllQuantitiesV per model.  The outputs
+   * are those of dyieldFunction_dstress, dyieldFunction_dintnl, flowPotential, dflowPotential_dstress
+   * and dflowPotential_dintnl, but note that the random perturbations of the stress made by
+   * some multi-surface models are then drawn model by model.
+   * @param stress the stress at which to calculate the quantities
+   * @param intnl vector of internal parameters
+   * @param active set of active constraints - only the active quantities are put into the outputs
+   * @param[out] df_dstress df_dstress[alpha](i, j) = dyieldFunction[alpha]/dstress(i, j)
+   * @param[out] df_dintnl df_dintnl[alpha] = dyieldFunction[alpha]/dintnl[alpha]
+   * @param[out] r the flow potentials
+   * @param[out] dr_dstress dr_dstress[alpha](i, j, k, l) = dr[alpha](i, j)/dstress(k, l)
+   * @param[out] dr_dintnl dr_dintnl[alpha](i, j) = dr[alpha](i, j)/dintnl[alpha]
+   */
+  void computeAllQuantities(const RankTwoTensor & stress, const std::vector<Real> & intnl, const std::vector<bool> & active, std::vector<RankTwoTensor> & df_dstress, std::vector<Real> & df_dintnl, std::vector<RankTwoTensor> & r, std::vector<RankFourTensor> & dr_dstress, std::vector<RankTwoTensor> & dr_dintnl);
+
   /**
    * Constructs a set of active constraints, given the yield functions, f.
    * This uses TensorMechanicsPlasticModel::activeConstraints to identify the active
@@ -258,6 +275,17 @@ protected:
    * @param[out] act the set of active constraints (will be resized to _num_surfaces)
    */
   void buildActiveConstraintsJoint(const std::vector<Real> & f, const RankTwoTensor & stress, const std::vector<Real> & intnl, const RankFourTensor & Eijkl, std::vector<bool> & act);
+
+private:
+  ///@{
+  /// Workspaces of computeAllQuantities for the quantities of one model
+  std::vector<RankTwoTensor> _model_df_dstress;
+  std::vector<Real> _model_df_dintnl;
+  std::vector<RankTwoTensor> _model_r;
+  std::vector<RankFourTensor> _model_dr_dstress;
+  std::vector<RankTwoTensor> _model_dr_dintnl;
+  std::vector<unsigned int> _active_surfaces_of_model;
+  ///@}
 };
 
 #endif //MULTIPLASTICITYRAWCOMPONENTASSEMBLER_H
@@ -0,0 +1,151 @@
+# A cube of one-point integrated HEX8 elements compressed on the top face.
+# Without the hourglass control the system is singular; with it the patch
+# deforms homogeneously: stress_zz = -E 0.01 t = -2000 t and the free faces
+# move by nu 0.01 t = 0.003 t.
+[GlobalParams]
+  displacements = 'disp_x disp_y disp_z'
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 3
+  ny = 3
+  nz = 3
+  elem_type = HEX8
+[]
+
+[Variables]
+  [./disp_x]
+  [../]
+  [./disp_y]
+  [../]
+  [./disp_z]
+  [../]
+[]
+
+[Kernels]
+  [./stress_x]
+    type = StressDivergenceTensors
+    variable = disp_x
+    component = 0
+  [../]
+  [./stress_y]
+    type = StressDivergenceTensors
+    variable = disp_y
+    component = 1
+  [../]
+  [./stress_z]
+    type = StressDivergenceTensors
+    variable = disp_z
+    component = 2
+  [../]
+  [./hourglass_x]
+    type = HexHourglassStabilization
+    variable = disp_x
+    shear_modulus = 0.75e5
+  [../]
+  [./hourglass_y]
+    type = HexHourglassStabilization
+    variable = disp_y
+    shear_modulus = 0.75e5
+  [../]
+  [./hourglass_z]
+    type = HexHourglassStabilization
+    variable = disp_z
+    shear_modulus = 0.75e5
+  [../]
+[]
+
+[AuxVariables]
+  [./stress_zz]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[AuxKernels]
+  [./stress_zz]
+    type = RankTwoAux
+    rank_two_tensor = stress
+    variable = stress_zz
+    index_i = 2
+    index_j = 2
+  [../]
+[]
+
+[BCs]
+  [./symmx]
+    type = PresetBC
+    variable = disp_x
+    boundary = left
+    value = 0
+  [../]
+  [./symmy]
+    type = PresetBC
+    variable = disp_y
+    boundary = bottom
+    value = 0
+  [../]
+  [./symmz]
+    type = PresetBC
+    variable = disp_z
+    boundary = back
+    value = 0
+  [../]
+  [./top]
+    type = FunctionPresetBC
+    variable = disp_z
+    boundary = front
+    function = '-0.01*t'
+  [../]
+[]
+
+[Materials]
+  [./elasticity_tensor]
+    type = ComputeIsotropicElasticityTensor
+    youngs_modulus = 2e5
+    poissons_ratio = 0.3
+  [../]
+  [./strain]
+    type = ComputeSmallStrain
+  [../]
+  [./stress]
+    type = ComputeLinearElasticStress
+  [../]
+[]
+
+[Postprocessors]
+  [./stress_zz]
+    type = ElementAverageValue
+    variable = stress_zz
+  [../]
+  [./disp_x_max]
+    type = NodalMaxValue
+    variable = disp_x
+  [../]
+[]
+
+[Preconditioning]
+  [./smp]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  dt = 0.5
+  end_time = 1
+  nl_rel_tol = 1e-10
+  nl_abs_tol = 1e-10
+
+  [./Quadrature]
+    order = CONSTANT
+  [../]
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,74 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+#ifndef WATERSTEAMPHTABLE_H
+#define WATERSTEAMPHTABLE_H
+
+#include "GeneralUserObject.h"
+#include "BicubicInterpolation.h"
+
+class WaterSteamPHTable;
+
+template<>
+InputParameters validParams<WaterSteamPHTable>();
+
+/**
+ * Water and steam properties as functions of pressure and specific enthalpy, interpolated
+ * (bicubic) from tables that are computed at startup with water_steam_prop_PH_noderiv.
+ * Lookups return the derivatives with respect to pressure and enthalpy, so the Fortran
+ * routines are only called to build the tables, and for points outside of them.
+ *
+ * The units are those of water_steam_prop_PH_noderiv: pressure in Pa, enthalpy in kJ/kg,
+ * temperature in C and density in kg/m^3.  The properties have kinks on the saturation
+ * lines, where the interpolation is less accurate than elsewhere.
+ */
+class WaterSteamPHTable : public GeneralUserObject
+{
+public:
+  WaterSteamPHTable(const InputParameters & parameters);
+
+  virtual void initialize() {}
+  virtual void execute() {}
+  virtual void finalize() {}
+
+  /// The tabulated properties
+  enum Property
+  {
+    TEMPERATURE = 0,
+    WATER_SATURATION,
+    DENSITY,
+    NUM_PROPERTIES
+  };
+
+  /// A property at (p, h)
+  Real value(Property property, Real pressure, Real enthalpy) const;
+
+  /// A property at (p, h) and its derivatives with respect to p and h
+  void valueAndDerivatives(Property property, Real pressure, Real enthalpy, Real & value, Real & dp, Real & dh) const;
+
+protected:
+  /// Evaluate all properties at (p, h) with water_steam_prop_PH_noderiv
+  void computeProperties(Real pressure, Real enthalpy, std::vector<Real> & values) const;
+
+  ///@{ Tabulated range
+  const Real _pressure_min;
+  const Real _pressure_max;
+  const Real _enthalpy_min;
+  const Real _enthalpy_max;
+  const unsigned int _num_p;
+  const unsigned int _num_h;
+  ///@}
+
+  /// Pressure and enthalpy grid
+  std::vector<Real> _pressure;
+  std::vector<Real> _enthalpy;
+
+  /// Bicubic interpolation of each property
+  std::vector<BicubicInterpolation> _interpolation;
+};
+
+#endif /* WATERSTEAMPHTABLE_H */
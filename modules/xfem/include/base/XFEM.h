@@ -37,6 +37,8 @@ enum XFEM_QRULE
 
 class XFEMCutElem;
 class XFEMGeometricCut;
+struct CutEdge;
+struct CutFace;
 class EFANode;
 class EFAEdge;
 class EFAElement;
@@ -164,6 +166,14 @@ private:
                         EFAElement3D* CEMElem,
                         std::vector<std::vector<Point> > &frag_faces) const;
 
+  /**
+   * Gather the element and fragment cut edges (or faces) found by each processor for its
+   * local elements, so that every processor has the cuts of all the elements
+   * @param cut_edges Map from element id to the element and fragment cuts
+   */
+  void gatherCutEdges(std::map<unsigned int, std::pair<std::vector<CutEdge>, std::vector<CutEdge> > > & cut_edges) const;
+  void gatherCutFaces(std::map<unsigned int, std::pair<std::vector<CutFace>, std::vector<CutFace> > > & cut_faces) const;
+
 private:
 
   /**
@@ -197,6 +207,9 @@ private:
   std::map<unique_id_type, unique_id_type> _new_node_to_parent_node;
 
   ElementFragmentAlgorithm _efa_mesh;
+
+  /// Whether _efa_mesh was built from the current mesh and has not been modified since
+  bool _efa_mesh_up_to_date;
 };
 
 #endif // XFEM_H
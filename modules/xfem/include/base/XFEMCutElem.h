@@ -13,6 +13,9 @@
 #include "MooseTypes.h"
 #include "XFEM.h"
 
+#include "libmesh/enum_order.h"
+#include "libmesh/enum_quadrature_type.h"
+
 using namespace libMesh;
 
 namespace libMesh
@@ -43,6 +46,8 @@ protected:
   Real _physical_volfrac;
   bool _have_weights;
   std::vector<Real> _new_weights; // quadrature weights from moment fitting
+  QuadratureType _weights_qrule_type; // quadrature rule that _new_weights were computed for
+  Order _weights_qrule_order;
   virtual Point getNodeCoordinates(EFANode* node, MeshBase* displaced_mesh = NULL) const = 0;
 
 public:
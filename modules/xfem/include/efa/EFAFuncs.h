@@ -12,6 +12,7 @@
 #include <set>
 #include <vector>
 #include <algorithm>
+#include <iterator>
 
 namespace Efa
 {
@@ -40,22 +41,41 @@ unsigned int getNewID(std::map<unsigned int, T*> &theMap)
   return new_elem_id;
 }
 
+/**
+ * Number of elements common to two sorted ranges, counted in the same way as
+ * std::set_intersection but without storing the intersection
+ */
+template <class InputIt1, class InputIt2>
+unsigned int countCommonElems(InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2)
+{
+  unsigned int num_common = 0;
+  while (first1 != last1 && first2 != last2)
+  {
+    if (*first1 < *first2)
+      ++first1;
+    else if (*first2 < *first1)
+      ++first2;
+    else
+    {
+      ++num_common;
+      ++first1;
+      ++first2;
+    }
+  }
+  return num_common;
+}
+
 template <class T>
 unsigned int numCommonElems(std::set<T> &v1, std::set<T> &v2)
 {
-  std::vector<T> common_elems;
-  std::set_intersection(v1.begin(), v1.end(), v2.begin(), v2.end(),
-                        std::inserter(common_elems, common_elems.end()));
-  return common_elems.size();
+  return countCommonElems(v1.begin(), v1.end(), v2.begin(), v2.end());
 }
 
+/// v2 must be sorted
 template <class T>
 unsigned int numCommonElems(std::set<T> &v1, std::vector<T> &v2)
 {
-  std::vector<T> common_elems;
-  std::set_intersection(v1.begin(), v1.end(), v2.begin(), v2.end(),
-                        std::inserter(common_elems, common_elems.end()));
-  return common_elems.size();
+  return countCommonElems(v1.begin(), v1.end(), v2.begin(), v2.end());
 }
 
 template <class T>
@@ -0,0 +1,55 @@
+#!/usr/bin/env python
+"""
+Reads the files written by the VectorPostprocessorBinary output.  The columns are
+memory mapped, nothing is read until the values are used:
+
+  from read_vpp_binary import read_vpp_binary
+  for record in read_vpp_binary('out_sampler.vpp'):
+    print record['time'], record['columns']['u'][-1]
+
+Run as a script to print a summary of the records of a file.
+"""
+import sys
+import numpy
+
+def read_vpp_binary(file_name):
+  """Returns a list with a dictionary for each record: 'time', 't_step' and 'columns' (name -> numpy array)"""
+  words = numpy.memmap(file_name, dtype=numpy.uint64, mode='r')
+  if words[:1].tostring() != b'MOOSEVPP':
+    raise ValueError('%s is not a VectorPostprocessorBinary file' % file_name)
+  if words[1] != 1:
+    raise ValueError('%s has the unsupported format version %d' % (file_name, words[1]))
+
+  # Header: the names are padded to a multiple of 8 bytes
+  n_columns = int(words[2])
+  offset = 3
+  names = []
+  for i in range(n_columns):
+    length = int(words[offset])
+    names.append(words[offset + 1:offset + 1 + (length + 7) // 8].tostring()[:length].decode())
+    offset += 1 + (length + 7) // 8
+
+  # Records: time, time step, the column lengths and the columns
+  records = []
+  values = numpy.memmap(file_name, dtype=numpy.float64, mode='r')
+  steps = numpy.memmap(file_name, dtype=numpy.int64, mode='r')
+  while offset + 2 + n_columns <= len(words):
+    record = {'time' : values[offset], 't_step' : int(steps[offset + 1]), 'columns' : {}}
+    sizes = [int(size) for size in words[offset + 2:offset + 2 + n_columns]]
+    offset += 2 + n_columns
+    if offset + sum(sizes) > len(words):
+      break
+    for name, size in zip(names, sizes):
+      record['columns'][name] = values[offset:offset + size]
+      offset += size
+    records.append(record)
+
+  return records
+
+if __name__ == '__main__':
+  if len(sys.argv) != 2:
+    print 'Usage: read_vpp_binary.py <file>'
+    sys.exit(1)
+  for record in read_vpp_binary(sys.argv[1]):
+    print 'time = %g, step = %d:' % (record['time'], record['t_step']),
+    print ', '.join(['%s (%d values)' % (name, len(column)) for name, column in sorted(record['columns'].items())])
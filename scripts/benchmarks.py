@@ -0,0 +1,210 @@
+#!/usr/bin/env python
+"""
+Runs the standard scalability benchmarks and records their performance in a
+JSON file that can be compared against the file of a previous run.
+
+The benchmark inputs are in modules/combined/tests/benchmarks (diffusion,
+stateful J2 plasticity, grain growth with the GrainTracker, PorousFlow THM and
+a MultiApp with transfers) and modules/combined/tests/contact_benchmark (sliding
+contact).  Each input reports the time spent in the residual and Jacobian
+evaluations, the solve and the output with PerformanceData postprocessors and
+the peak memory of the largest processor with a MemoryUsage postprocessor.
+
+For strong scaling the problem size is the same for every processor count, for
+weak scaling the number of elements grows with the number of processors.  Every
+combination of the requested processor and thread counts is run:
+
+  ./benchmarks.py --scaling weak --procs 1 2 4 8 --json after.json --compare before.json
+
+The effect of the element and node ordering on the residual and Jacobian loops
+(cache reuse of the nodal data, matrix bandwidth) is measured by comparing runs
+with and without Mesh/ordering:
+
+  ./benchmarks.py --json none.json
+  ./benchmarks.py --ordering hilbert_sfc --compare none.json
+
+This is also the "benchmarks" make target of the applications, with the options
+passed in BENCHMARK_OPTIONS.
+"""
+import os, sys, csv, json, math, time, argparse, subprocess, tempfile, shutil, socket
+
+MOOSE_DIR = os.path.abspath(os.getenv('MOOSE_DIR', os.path.join(os.path.dirname(__file__), '..')))
+INPUT_DIR = os.path.join(MOOSE_DIR, 'modules', 'combined', 'tests')
+
+# The input, the mesh dimension and the number of elements in each direction (or the number of
+# uniform refinements for the file meshes) of each problem at scale 1 on one processor
+CASES = {'diffusion' : ('benchmarks/diffusion.i', 3, 20),
+         'plasticity' : ('benchmarks/plasticity.i', 3, 10),
+         'grain_growth' : ('benchmarks/grain_growth.i', 2, 50),
+         'porous_flow_thm' : ('benchmarks/porous_flow_thm.i', 3, 10),
+         'multiapp' : ('benchmarks/multiapp_master.i', 3, 10),
+         'contact' : ('contact_benchmark/sliding_blocks.i', 2, 0)}
+CASE_ORDER = ['diffusion', 'plasticity', 'grain_growth', 'porous_flow_thm', 'multiapp', 'contact']
+
+# The postprocessors read from the last row of the CSV file and their names in the results
+COLUMNS = [('residual_time', 'residual_time'),
+           ('jacobian_time', 'jacobian_time'),
+           ('solve_time', 'solve_time'),
+           ('output_time', 'output_time'),
+           ('peak_memory', 'peak_memory_mb'),
+           ('n_elems', 'elements'),
+           ('n_dofs', 'dofs')]
+
+# The results that are compared with a previous run
+COMPARED = ['residual_time', 'jacobian_time', 'solve_time', 'output_time', 'peak_memory_mb', 'wall_time']
+
+def meshArgs(options, case, n_procs):
+  """The command line arguments that size the mesh of a case"""
+  input_file, dim, size = CASES[case]
+  weak = options.scaling == 'weak'
+
+  # The file meshes can only grow by uniform refinement, which multiplies the number of elements by 2^dim
+  if case == 'contact':
+    refine = size + options.refine
+    if weak:
+      refine += int(round(math.log(n_procs) / math.log(2**dim)))
+    return ['Mesh/uniform_refine=%d' % refine]
+
+  n = size * options.scale
+  if weak:
+    n *= n_procs**(1. / dim)
+  n = max(1, int(round(n)))
+
+  args = []
+  for direction in ['nx', 'ny', 'nz'][:dim]:
+    args.append('Mesh/%s=%d' % (direction, n))
+    if case == 'multiapp':
+      args.append('sub:Mesh/%s=%d' % (direction, n))
+  return args
+
+def run(options, case, n_procs, n_threads, work_dir):
+  """Runs one case and returns a dictionary of the results, or None if the run failed"""
+  file_base = os.path.join(work_dir, '%s_%d_%d' % (case, n_procs, n_threads))
+
+  cli_args = meshArgs(options, case, n_procs) + \
+             ['Executioner/num_steps=%d' % options.steps,
+              'Outputs/file_base=%s' % file_base,
+              'Outputs/print_perf_log=false']
+  if options.ordering != 'none':
+    cli_args.append('Mesh/ordering=%s' % options.ordering)
+  if case == 'multiapp':
+    cli_args.append('sub:Executioner/num_steps=%d' % options.steps)
+
+  command = [options.executable, '-i', os.path.join(INPUT_DIR, CASES[case][0])] + cli_args
+  if n_threads > 1:
+    command.append('--n-threads=%d' % n_threads)
+  if n_procs > 1:
+    command = options.mpiexec.split() + ['-n', str(n_procs)] + command
+
+  start = time.time()
+  with open(os.devnull, 'w') as devnull:
+    code = subprocess.call(command, stdout=devnull, stderr=subprocess.STDOUT)
+  wall_time = time.time() - start
+
+  csv_file = file_base + '.csv'
+  if code != 0 or not os.path.exists(csv_file):
+    return None
+
+  # The timings accumulate over the time steps, the last row has the totals
+  with open(csv_file) as f:
+    rows = list(csv.DictReader(f))
+  result = {'case' : case,
+            'scaling' : options.scaling,
+            'procs' : n_procs,
+            'threads' : n_threads,
+            'wall_time' : wall_time}
+  for pp, key in COLUMNS:
+    result[key] = float(rows[-1][pp])
+  result['elements'] = int(result['elements'])
+  result['dofs'] = int(result['dofs'])
+  return result
+
+def key(result):
+  """The results of two runs are compared if these match"""
+  return (result['case'], result['scaling'], result['procs'], result['threads'], result['elements'])
+
+def compare(results, file_name):
+  """Prints the ratio of the results to the matching results of a previous run"""
+  with open(file_name) as f:
+    previous = dict([(key(result), result) for result in json.load(f)['results']])
+
+  print('\nRatio to ' + file_name + ' (below 1 is better):')
+  print(''.join(['%18s' % name for name in ['case', 'procs', 'threads'] + COMPARED]))
+  for result in results:
+    old = previous.get(key(result))
+    if old is None:
+      print('%18s%18d%18d    not in the previous run' % (result['case'], result['procs'], result['threads']))
+      continue
+    ratios = [result[name] / old[name] if old.get(name) else float('nan') for name in COMPARED]
+    print(('%18s%18d%18d' + '%18.3f' * len(COMPARED)) % tuple([result['case'], result['procs'], result['threads']] + ratios))
+
+def revision():
+  """The git revision of MOOSE, or None"""
+  try:
+    return subprocess.check_output(['git', '-C', MOOSE_DIR, 'rev-parse', 'HEAD'], stderr=subprocess.STDOUT).decode().strip()
+  except (OSError, subprocess.CalledProcessError):
+    return None
+
+def main():
+  parser = argparse.ArgumentParser(description='Runs the scalability benchmarks.')
+  parser.add_argument('--executable', default=os.path.join(MOOSE_DIR, 'modules', 'combined', 'modules-' + os.getenv('METHOD', 'opt')),
+                      help='The application to run, it must include the modules (default: the combined modules-$METHOD)')
+  parser.add_argument('--mpiexec', default='mpiexec', help='The MPI launcher (default: mpiexec)')
+  parser.add_argument('--cases', nargs='+', default=CASE_ORDER, choices=CASE_ORDER, help='The problems to run (default: all)')
+  parser.add_argument('--scaling', default='strong', choices=['strong', 'weak'],
+                      help='Keep the problem size constant (strong) or proportional to the number of processors (weak)')
+  parser.add_argument('--procs', nargs='+', type=int, default=[1], help='The numbers of processors')
+  parser.add_argument('--threads', nargs='+', type=int, default=[1], help='The numbers of threads per processor')
+  parser.add_argument('--scale', type=float, default=1., help='Multiplies the number of elements in each direction of the generated meshes')
+  parser.add_argument('--refine', type=int, default=0, help='Additional uniform refinements of the file meshes')
+  parser.add_argument('--ordering', default='none', choices=['none', 'hilbert_sfc', 'morton_sfc'],
+                      help='Renumber the elements and nodes along a space-filling curve (Mesh/ordering, default: none)')
+  parser.add_argument('--steps', type=int, default=3, help='The number of time steps')
+  parser.add_argument('--json', help='Write the results to this JSON file')
+  parser.add_argument('--compare', help='Compare the results to this JSON file written by a previous run')
+  options = parser.parse_args()
+
+  if not os.path.exists(options.executable):
+    print('The executable %s does not exist, build it or use --executable' % options.executable)
+    return 1
+
+  keys = ['case', 'procs', 'threads', 'elements', 'dofs', 'residual_time', 'jacobian_time', 'solve_time', 'output_time', 'wall_time', 'peak_memory_mb']
+  results = []
+  failed = 0
+  work_dir = tempfile.mkdtemp()
+  try:
+    print(''.join(['%18s' % name for name in keys]))
+    for case in options.cases:
+      for n_procs in options.procs:
+        for n_threads in options.threads:
+          result = run(options, case, n_procs, n_threads, work_dir)
+          if result is None:
+            failed += 1
+            print('%18s%18d%18d    FAILED' % (case, n_procs, n_threads))
+            continue
+          results.append(result)
+          print(('%18s%18d%18d%18d%18d' + '%18.4e' * 5 + '%18.1f') % tuple([result[name] for name in keys]))
+          sys.stdout.flush()
+  finally:
+    shutil.rmtree(work_dir)
+
+  if options.json:
+    metadata = {'executable' : options.executable,
+                'revision' : revision(),
+                'host' : socket.gethostname(),
+                'date' : time.strftime('%Y-%m-%d %H:%M:%S'),
+                'scaling' : options.scaling,
+                'scale' : options.scale,
+                'refine' : options.refine,
+                'ordering' : options.ordering,
+                'steps' : options.steps}
+    with open(options.json, 'w') as f:
+      json.dump({'metadata' : metadata, 'results' : results}, f, indent=2, sort_keys=True)
+
+  if options.compare:
+    compare(results, options.compare)
+
+  return 1 if failed else 0
+
+if __name__ == '__main__':
+  sys.exit(main())
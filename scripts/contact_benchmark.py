@@ -0,0 +1,124 @@
+#!/usr/bin/env python
+"""
+Measures where the time goes in mechanical contact problems as the number of
+slave nodes and the number of processors grow.
+
+Every combination of the requested parameters runs one of the inputs in
+modules/combined/tests/contact_benchmark, refined uniformly the requested
+number of times.  The time spent in the contact search (nearest node and
+penetration), the constraint residual and Jacobian assembly, the complete
+residual and Jacobian evaluations and the solve are read from the
+PerformanceData postprocessors of processor 0 and the peak resident memory of
+the largest process is measured by a wrapper around the run.  The results are
+printed as a table and can be written to a CSV file, for comparison between
+two builds:
+
+  ./contact_benchmark.py --cases sliding_blocks hertz_cyl --refine 0 1 2 --procs 1 4 --csv before.csv
+"""
+import os, sys, csv, argparse, subprocess, tempfile, shutil, resource
+
+CASES = ['sliding_blocks', 'hertz_cyl', 'blocks_3d_fieldsplit']
+
+# The timing postprocessors in the inputs and the names of their columns in the table
+PHASES = [('nearest_node_time', 'nearest_node'),
+          ('penetration_time', 'penetration'),
+          ('constraint_residual_time', 'constraint_res'),
+          ('constraint_jacobian_time', 'constraint_jac'),
+          ('residual_time', 'residual'),
+          ('jacobian_time', 'jacobian'),
+          ('solve_time', 'solve')]
+
+MOOSE_DIR = os.path.abspath(os.getenv('MOOSE_DIR', os.path.join(os.path.dirname(__file__), '..')))
+INPUT_DIR = os.path.join(MOOSE_DIR, 'modules', 'combined', 'tests', 'contact_benchmark')
+
+def measure(command):
+  """
+  Runs command and prints the peak resident memory (in kB on Linux) of the largest process
+  it started.  This is called in a separate interpreter so that the maximum of previous runs
+  is not included.
+  """
+  with open(os.devnull, 'w') as devnull:
+    code = subprocess.call(command, stdout=devnull, stderr=subprocess.STDOUT)
+  print(resource.getrusage(resource.RUSAGE_CHILDREN).ru_maxrss)
+  return code
+
+def run(options, case, refine, n_procs, work_dir):
+  """Runs one case and returns a dictionary of the results, or None if the run failed"""
+  file_base = os.path.join(work_dir, '%s_%d_%d' % (case, refine, n_procs))
+
+  cli_args = ['Mesh/uniform_refine=%d' % refine,
+              'Executioner/num_steps=%d' % options.steps,
+              'Outputs/file_base=%s' % file_base,
+              'Outputs/print_perf_log=false']
+
+  command = [options.executable, '-i', os.path.join(INPUT_DIR, case + '.i')] + cli_args
+  if n_procs > 1:
+    command = options.mpiexec.split() + ['-n', str(n_procs)] + command
+
+  output = subprocess.Popen([sys.executable, os.path.abspath(__file__), '--measure'] + command,
+                            stdout=subprocess.PIPE).communicate()[0]
+  lines = output.decode().split()
+  csv_file = file_base + '.csv'
+  if not lines or not os.path.exists(csv_file):
+    return None
+
+  # The timings accumulate over the time steps, the last row has the totals.  The slave
+  # node count is only computed initially, so take the first row that has it.
+  with open(csv_file) as f:
+    rows = list(csv.DictReader(f))
+  result = {'case' : case,
+            'slave_nodes' : int(float(rows[0]['n_slave_nodes'])),
+            'procs' : n_procs,
+            'nl_its' : sum([int(float(row['nonlinear_its'])) for row in rows]),
+            'peak_memory_mb' : float(lines[-1]) / 1024.}
+  for pp, key in PHASES:
+    result[key] = float(rows[-1][pp])
+  return result
+
+def main():
+  if len(sys.argv) > 1 and sys.argv[1] == '--measure':
+    return measure(sys.argv[2:])
+
+  parser = argparse.ArgumentParser(description='Measures the cost of the contact search, assembly and solve.')
+  parser.add_argument('--executable', default=os.path.join(MOOSE_DIR, 'modules', 'combined', 'modules-' + os.getenv('METHOD', 'opt')),
+                      help='The application to run (default: the combined modules-$METHOD)')
+  parser.add_argument('--mpiexec', default='mpiexec', help='The MPI launcher (default: mpiexec)')
+  parser.add_argument('--cases', nargs='+', default=CASES, choices=CASES, help='The problems to run (default: all)')
+  parser.add_argument('--refine', nargs='+', type=int, default=[0, 1], help='The numbers of uniform refinements of the meshes')
+  parser.add_argument('--procs', nargs='+', type=int, default=[1], help='The numbers of processors')
+  parser.add_argument('--steps', type=int, default=3, help='The number of time steps')
+  parser.add_argument('--csv', help='Write the results to this CSV file')
+  options = parser.parse_args()
+
+  if not os.path.exists(options.executable):
+    print('The executable %s does not exist, build it or use --executable' % options.executable)
+    return 1
+
+  keys = ['case', 'slave_nodes', 'procs', 'nl_its'] + [key for pp, key in PHASES] + ['peak_memory_mb']
+  results = []
+  work_dir = tempfile.mkdtemp()
+  try:
+    print(''.join(['%22s' % keys[0]] + ['%15s' % key for key in keys[1:]]))
+    for case in options.cases:
+      for refine in options.refine:
+        for n_procs in options.procs:
+          result = run(options, case, refine, n_procs, work_dir)
+          if result is None:
+            print('%22s%15s%15d    FAILED (uniform_refine = %d)' % (case, '-', n_procs, refine))
+            continue
+          results.append(result)
+          print(('%22s%15d%15d%15d' + '%15.4e' * len(PHASES) + '%15.1f') % tuple([result[key] for key in keys]))
+          sys.stdout.flush()
+  finally:
+    shutil.rmtree(work_dir)
+
+  if options.csv:
+    with open(options.csv, 'w') as f:
+      writer = csv.DictWriter(f, fieldnames=keys)
+      writer.writeheader()
+      writer.writerows(results)
+
+  return 0
+
+if __name__ == '__main__':
+  sys.exit(main())
@@ -0,0 +1,78 @@
+#!/usr/bin/env python
+"""
+Converts a GriddedData text file (as read by PiecewiseMultilinear) into the
+binary format that GriddedData memory maps, so that large tables are not
+parsed on every processor:
+
+  ./gridded_data_to_binary.py table.txt table.bin
+
+The binary file is written in the native byte order; see GriddedData.C for
+a description of the format.
+"""
+import sys, struct, argparse
+
+AXES = {'AXIS X' : 0, 'AXIS Y' : 1, 'AXIS Z' : 2, 'AXIS T' : 3}
+
+def significantLines(file_name):
+  """Yields the lines of the file that are not empty and do not start with #"""
+  with open(file_name) as f:
+    for line in f:
+      line = line.rstrip('\n')
+      if line and not line.startswith('#'):
+        yield line
+
+def parse(file_name):
+  """Returns the axes, grid and function values of a GriddedData text file"""
+  axes, grid, values = [], [], []
+  reading_values = False
+  lines = significantLines(file_name)
+  for line in lines:
+    if line in AXES:
+      axes.append(AXES[line])
+      grid.append([float(x) for x in next(lines, '').split()])
+    elif reading_values:
+      values += [float(x) for x in line.split()]
+    elif line == 'DATA':
+      reading_values = True
+
+  if not axes:
+    raise ValueError('No valid AXIS lines found in %s' % file_name)
+
+  num_values = 1
+  for i, axis in enumerate(grid):
+    if not axis:
+      raise ValueError('Axis %d in %s has zero size' % (i, file_name))
+    num_values *= len(axis)
+  if num_values != len(values):
+    raise ValueError('The AXIS statements in %s give %d data points but %d function values were read' % (file_name, num_values, len(values)))
+
+  return axes, grid, values
+
+def write(file_name, axes, grid, values):
+  """Writes the binary GriddedData file"""
+  with open(file_name, 'wb') as f:
+    f.write(b'MOOSEGRD')
+    f.write(struct.pack('=QQ', 1, len(axes)))
+    f.write(struct.pack('=%dq' % len(axes), *axes))
+    f.write(struct.pack('=%dQ' % len(grid), *[len(axis) for axis in grid]))
+    for axis in grid:
+      f.write(struct.pack('=%dd' % len(axis), *axis))
+    f.write(struct.pack('=%dd' % len(values), *values))
+
+def main():
+  parser = argparse.ArgumentParser(description='Converts a GriddedData text file to the binary format.')
+  parser.add_argument('input', help='The GriddedData text file')
+  parser.add_argument('output', help='The binary file to write')
+  options = parser.parse_args()
+
+  try:
+    axes, grid, values = parse(options.input)
+  except ValueError as e:
+    print(e)
+    return 1
+
+  write(options.output, axes, grid, values)
+  return 0
+
+if __name__ == '__main__':
+  sys.exit(main())
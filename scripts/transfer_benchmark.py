@@ -0,0 +1,120 @@
+#!/usr/bin/env python
+"""
+Measures the cost of the MultiApp transfers as the mesh size, the number of
+sub-apps and the number of processors grow.
+
+Every combination of the requested parameters runs the inputs in
+test/tests/transfers/benchmark with a single transfer active.  The time spent
+in the transfer is read from the PerformanceData postprocessors of the master
+(processor 0) and the peak resident memory of the largest process is measured
+by a wrapper around the run.  The results are printed as a table and can be
+written to a CSV file, for comparison between two builds:
+
+  ./transfer_benchmark.py --sizes 10 20 40 --subapps 1 4 --procs 1 4 --csv before.csv
+"""
+import os, sys, csv, argparse, subprocess, tempfile, shutil, resource
+
+TRANSFERS = ['copy', 'mesh_function', 'nearest_node', 'interpolation', 'projection', 'user_object']
+
+MOOSE_DIR = os.path.abspath(os.getenv('MOOSE_DIR', os.path.join(os.path.dirname(__file__), '..')))
+INPUT_DIR = os.path.join(MOOSE_DIR, 'test', 'tests', 'transfers', 'benchmark')
+
+def measure(command):
+  """
+  Runs command and prints the peak resident memory (in kB on Linux) of the largest process
+  it started.  This is called in a separate interpreter so that the maximum of previous runs
+  is not included.
+  """
+  with open(os.devnull, 'w') as devnull:
+    code = subprocess.call(command, stdout=devnull, stderr=subprocess.STDOUT)
+  print(resource.getrusage(resource.RUSAGE_CHILDREN).ru_maxrss)
+  return code
+
+def run(options, transfer, size, n_subapps, n_procs, work_dir):
+  """Runs one case and returns a dictionary of the results, or None if the run failed"""
+  file_base = os.path.join(work_dir, '%s_%d_%d_%d' % (transfer, size, n_subapps, n_procs))
+  positions = ' '.join(['0 0 0'] * n_subapps)
+
+  cli_args = ['Transfers/active=%s' % transfer,
+              'Postprocessors/transfer_calls/event=%s' % transfer,
+              'MultiApps/sub/positions=%s' % positions,
+              'Executioner/num_steps=%d' % options.steps,
+              'sub:Executioner/num_steps=%d' % options.steps,
+              'Outputs/file_base=%s' % file_base]
+  for direction in ['nx', 'ny', 'nz']:
+    cli_args += ['Mesh/%s=%d' % (direction, size), 'sub:Mesh/%s=%d' % (direction, size)]
+
+  command = [options.executable, '-i', os.path.join(INPUT_DIR, 'master.i')] + cli_args
+  if n_procs > 1:
+    command = options.mpiexec.split() + ['-n', str(n_procs)] + command
+
+  output = subprocess.Popen([sys.executable, os.path.abspath(__file__), '--measure'] + command,
+                            stdout=subprocess.PIPE).communicate()[0]
+  lines = output.decode().split()
+  csv_file = file_base + '.csv'
+  if not lines or not os.path.exists(csv_file):
+    return None
+
+  # The postprocessors accumulate over the time steps, the last row has the totals
+  with open(csv_file) as f:
+    rows = list(csv.DictReader(f))
+  calls = float(rows[-1]['transfer_calls'])
+  time = float(rows[-1][transfer + '_time'])
+
+  return {'transfer' : transfer,
+          'elements' : size**3,
+          'subapps' : n_subapps,
+          'procs' : n_procs,
+          'calls' : int(calls),
+          'time_per_transfer' : time / calls if calls > 0 else 0.,
+          'peak_memory_mb' : float(lines[-1]) / 1024.}
+
+def main():
+  if len(sys.argv) > 1 and sys.argv[1] == '--measure':
+    return measure(sys.argv[2:])
+
+  parser = argparse.ArgumentParser(description='Measures the cost of the MultiApp transfers.')
+  parser.add_argument('--executable', default=os.path.join(MOOSE_DIR, 'test', 'moose_test-' + os.getenv('METHOD', 'opt')),
+                      help='The application to run (default: moose_test-$METHOD)')
+  parser.add_argument('--mpiexec', default='mpiexec', help='The MPI launcher (default: mpiexec)')
+  parser.add_argument('--transfers', nargs='+', default=TRANSFERS, choices=TRANSFERS, help='The transfers to measure (default: all)')
+  parser.add_argument('--sizes', nargs='+', type=int, default=[10, 20], help='The number of elements in each direction of the meshes')
+  parser.add_argument('--subapps', nargs='+', type=int, default=[1], help='The numbers of sub-apps')
+  parser.add_argument('--procs', nargs='+', type=int, default=[1], help='The numbers of processors')
+  parser.add_argument('--steps', type=int, default=3, help='The number of time steps, each transfer is executed once per step')
+  parser.add_argument('--csv', help='Write the results to this CSV file')
+  options = parser.parse_args()
+
+  if not os.path.exists(options.executable):
+    print('The executable %s does not exist, build it or use --executable' % options.executable)
+    return 1
+
+  keys = ['transfer', 'elements', 'subapps', 'procs', 'calls', 'time_per_transfer', 'peak_memory_mb']
+  results = []
+  work_dir = tempfile.mkdtemp()
+  try:
+    print(''.join(['%18s' % key for key in keys]))
+    for transfer in options.transfers:
+      for size in options.sizes:
+        for n_subapps in options.subapps:
+          for n_procs in options.procs:
+            result = run(options, transfer, size, n_subapps, n_procs, work_dir)
+            if result is None:
+              print('%18s%18d%18d%18d    FAILED' % (transfer, size**3, n_subapps, n_procs))
+              continue
+            results.append(result)
+            print('%18s%18d%18d%18d%18d%18.4e%18.1f' % tuple([result[key] for key in keys]))
+            sys.stdout.flush()
+  finally:
+    shutil.rmtree(work_dir)
+
+  if options.csv:
+    with open(options.csv, 'w') as f:
+      writer = csv.DictWriter(f, fieldnames=keys)
+      writer.writeheader()
+      writer.writerows(results)
+
+  return 0
+
+if __name__ == '__main__':
+  sys.exit(main())
@@ -0,0 +1,47 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+#ifndef DUALPHARMONIC_H
+#define DUALPHARMONIC_H
+
+#include "Kernel.h"
+#include "DualNumber.h"
+
+//Forward Declarations
+class DualPHarmonic;
+
+template<>
+InputParameters validParams<DualPHarmonic>();
+
+/**
+ * The PHarmonic kernel (grad(v), |grad(u)|^(p-2) grad(u)) with the flux computed in DualNumbers
+ * of the components of grad(u), so that the Jacobian is exact for any p.
+ */
+class DualPHarmonic : public Kernel
+{
+public:
+  DualPHarmonic(const InputParameters & parameters);
+
+protected:
+  virtual Real computeQpResidual();
+  virtual Real computeQpJacobian();
+
+  typedef DualNumber<Real, LIBMESH_DIM> DualGradReal;
+
+  /// The flux |grad(u)|^(p-2) grad(u) and its derivatives with respect to the components of grad(u)
+  void computeQpFlux(DualGradReal flux[LIBMESH_DIM]);
+
+  const Real _p;
+};
+
+#endif //DUALPHARMONIC_H
@@ -0,0 +1,72 @@
+# A linear transient problem solved with NEWTON and an exact (LU)
+# linear solver, so every time step converges in a single nonlinear
+# iteration and the Jacobian never changes.  The number of Jacobian
+# evaluations and preconditioner rebuilds is controlled by the
+# lag_jacobian, lag_preconditioner and lag_unit Executioner options.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./ie]
+    type = TimeDerivative
+    variable = u
+  [../]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Postprocessors]
+  [./jacobian_evaluations]
+    type = NumJacobianEvaluations
+  [../]
+  [./preconditioner_rebuilds]
+    type = NumJacobianEvaluations
+    matrix = preconditioner
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 5
+  dt = 0.1
+
+  solve_type = NEWTON
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+  l_tol = 1e-12
+  nl_rel_tol = 1e-8
+
+  lag_jacobian = -1
+  lag_unit = solve
+[]
+
+[Outputs]
+  csv = true
+[]
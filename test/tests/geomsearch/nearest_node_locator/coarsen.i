@@ -0,0 +1,88 @@
+# The mesh is coarsened back to the generated one after the first step.  The distance between
+# the nodes of the left and right sides stays 1 and the solution stays u = x on both meshes.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 4
+  ny = 4
+  uniform_refine = 1
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./distance]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[AuxKernels]
+  [./distance]
+    type = NearestNodeDistanceAux
+    variable = distance
+    boundary = left
+    paired_boundary = right
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Postprocessors]
+  [./max_distance]
+    type = NodalMaxValue
+    variable = distance
+    boundary = left
+  [../]
+  [./average_u]
+    type = ElementAverageValue
+    variable = u
+  [../]
+  [./element_size]
+    type = AverageElementSize
+    variable = u
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 3
+  dt = 1
+  solve_type = 'NEWTON'
+[]
+
+[Adaptivity]
+  marker = uniform
+  [./Markers]
+    [./uniform]
+      type = UniformMarker
+      mark = coarsen
+    [../]
+  [../]
+[]
+
+[Outputs]
+  execute_on = 'timestep_end'
+  csv = true
+[]
@@ -0,0 +1,103 @@
+[Mesh]
+  file = 2dcontact_collide.e
+[]
+
+[Variables]
+  [./u]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+[]
+
+[AuxVariables]
+  [./penetration]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./refine]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[AuxKernels]
+  [./penetration]
+    type = PenetrationAux
+    variable = penetration
+    boundary = 2
+    paired_boundary = 3
+  [../]
+  [./refine]
+    type = FunctionAux
+    variable = refine
+    function = 'if(t<0.3,1,0)'
+  [../]
+[]
+
+[BCs]
+  [./block1_left]
+    type = DirichletBC
+    variable = u
+    boundary = 1
+    value = 0
+  [../]
+  [./block1_right]
+    type = DirichletBC
+    variable = u
+    boundary = 2
+    value = 1
+  [../]
+  [./block2_left]
+    type = DirichletBC
+    variable = u
+    boundary = 3
+    value = 0
+  [../]
+  [./block2_right]
+    type = DirichletBC
+    variable = u
+    boundary = 4
+    value = 1
+  [../]
+[]
+
+[Executioner]
+  # There is no time derivative, each step solves the problem of quadrature_penetration_locator.i
+  type = Transient
+  num_steps = 4
+  dt = 0.25
+
+  # Preconditioned JFNK (default)
+  solve_type = 'PJFNK'
+[]
+
+# The mesh is refined after the first step and coarsened back after the second one, which
+# regenerates the quadrature nodes on the refined sides and then on the original ones
+[Adaptivity]
+  marker = refine_coarsen
+
+  [./Markers]
+    [./refine_coarsen]
+      type = ValueThresholdMarker
+      variable = refine
+      refine = 0.5
+      coarsen = 0.5
+    [../]
+  [../]
+[]
+
+[Outputs]
+  [./exodus]
+    type = Exodus
+    file_base = quadrature_penetration_locator_out
+    execute_on = final
+    hide = 'refine refine_coarsen'
+  [../]
+[]
@@ -0,0 +1,46 @@
+# The Jacobian of DualPHarmonic comes from the DualNumber derivatives of its flux
+# and is exact for p != 2, unlike the Jacobian of PHarmonic
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 3
+  ny = 3
+[]
+
+[Variables]
+  [./u]
+    [./InitialCondition]
+      type = FunctionIC
+      function = 'x + y * y + 1'
+    [../]
+  [../]
+[]
+
+[Kernels]
+  [./pharmonic]
+    type = DualPHarmonic
+    variable = u
+    p = 3.5
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 1
+  [../]
+[]
+
+[Preconditioning]
+  [./smp]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = NEWTON
+[]
@@ -0,0 +1,89 @@
+# Only the aux kernel uses a material property, so with lazy_materials the
+# "supplier" material is computed in the aux loop only and the "unused"
+# material is never computed.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./a]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[AuxKernels]
+  [./a]
+    type = MaterialRealAux
+    variable = a
+    property = a
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Materials]
+  [./supplier]
+    type = GenericConstantMaterial
+    prop_names = 'a'
+    prop_values = '1'
+  [../]
+  [./unused]
+    type = GenericConstantMaterial
+    prop_names = 'b'
+    prop_values = '2'
+  [../]
+[]
+
+[Postprocessors]
+  [./supplier_calls]
+    type = PerformanceData
+    category = computeProperties
+    column = n_calls
+    event = supplier
+  [../]
+  [./unused_calls]
+    type = PerformanceData
+    category = computeProperties
+    column = n_calls
+    event = unused
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = NEWTON
+[]
+
+[Outputs]
+  csv = true
+[]
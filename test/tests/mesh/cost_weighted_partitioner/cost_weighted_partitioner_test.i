@@ -0,0 +1,89 @@
+###########################################################
+# The cost weighted partitioner repartitions a transient
+# solve with a stateful material whenever the measured
+# residual time is imbalanced at all, which moves the
+# stateful properties between processors.
+###########################################################
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  xmin = 0
+  xmax = 10
+  ymin = 0
+  ymax = 10
+  nx = 20
+  ny = 20
+
+  [./Partitioner]
+    type = CostWeightedPartitioner
+    imbalance_threshold = 1
+    check_interval = 1
+  [../]
+  parallel_type = replicated
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./proc_id]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[AuxKernels]
+  [./proc_id]
+    type = ProcessorIDAux
+    variable = proc_id
+  [../]
+[]
+
+[Kernels]
+  [./heat]
+    type = MatDiffusion
+    variable = u
+    prop_name = thermal_conductivity
+  [../]
+  [./ie]
+    type = TimeDerivative
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = 3
+    value = 0.0
+  [../]
+  [./right]
+    type = MTBC
+    variable = u
+    boundary = 1
+    grad = 1.0
+    prop_name = thermal_conductivity
+  [../]
+[]
+
+[Materials]
+  [./stateful]
+    type = StatefulSpatialTest
+    block = 0
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'PJFNK'
+  num_steps = 4
+  dt = .1
+[]
+
+[Outputs]
+  exodus = true
+[]
@@ -0,0 +1,55 @@
+###########################################################
+# The first run reads square.e and writes the split cache
+# into the cache directory, the second run reads the mesh
+# from the cache.  Both give the same solution.
+###########################################################
+
+[Mesh]
+  file = square.e
+  split_cache = true
+  split_cache_directory = cache
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = 1
+    value = 2
+  [../]
+
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = 2
+    value = 1
+  [../]
+[]
+
+[Materials]
+  [./empty]
+    type = MTMaterial
+    block = 1
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = 'PJFNK'
+[]
+
+[Outputs]
+  exodus = true
+[]
@@ -0,0 +1,66 @@
+# The initial condition of the sub-app depends on time, the sub-app is reset at t = 0.05
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+  [./td]
+    type = TimeDerivative
+    variable = u
+  [../]
+[]
+
+[Postprocessors]
+  [./sub_average]
+    type = Receiver
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 10
+  dt = 0.01
+  solve_type = 'PJFNK'
+[]
+
+[Outputs]
+  execute_on = 'timestep_end'
+  csv = true
+[]
+
+[MultiApps]
+  [./sub]
+    type = TransientMultiApp
+    app_type = MooseTestApp
+    execute_on = timestep_end
+    positions = '0 0 0'
+    input_files = time_ic_sub.i
+    reset_apps = 0
+    reset_time = 0.05
+    share_mesh = true
+    share_initial_condition = true
+  [../]
+[]
+
+[Transfers]
+  [./sub_average]
+    type = MultiAppPostprocessorTransfer
+    direction = from_multiapp
+    multi_app = sub
+    from_postprocessor = average
+    to_postprocessor = sub_average
+    reduction_type = average
+  [../]
+[]
@@ -0,0 +1,39 @@
+# Without boundary conditions the uniform initial condition u = 1 + 2 t is kept
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[Variables]
+  [./u]
+    [./InitialCondition]
+      type = FunctionIC
+      function = '1+2*t'
+    [../]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+  [./td]
+    type = TimeDerivative
+    variable = u
+  [../]
+[]
+
+[Postprocessors]
+  [./average]
+    type = ElementAverageValue
+    variable = u
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'PJFNK'
+[]
@@ -0,0 +1,92 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 4
+  ny = 4
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = MatDiffusion
+    variable = u
+    prop_name = thermal_conductivity
+    prop_state = 'old'
+  [../]
+  [./ie]
+    type = TimeDerivative
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Materials]
+  [./stateful]
+    type = StatefulTest
+  [../]
+[]
+
+[Postprocessors]
+  [./physical_memory]
+    type = MemoryUsage
+  [../]
+  [./peak_physical_memory]
+    type = MemoryUsage
+    value_type = peak
+  [../]
+  [./material_properties]
+    type = MemoryUsage
+    data = material_properties
+    reduction = total
+    units = bytes
+  [../]
+  [./thermal_conductivity_old]
+    type = MemoryUsage
+    data = material_properties
+    property = thermal_conductivity
+    state = old
+    reduction = total
+    units = bytes
+  [../]
+  [./mesh]
+    type = MemoryUsage
+    data = mesh
+    value_type = peak
+    units = kilobytes
+  [../]
+  [./restartable_data]
+    type = MemoryUsage
+    data = restartable_data
+    reduction = average
+    units = kilobytes
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 3
+  dt = 0.1
+  solve_type = PJFNK
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,76 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = NeumannBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Postprocessors]
+  [./diff_residual_calls]
+    type = PerformanceData
+    category = computeResidual
+    column = n_calls
+    event = diff
+  [../]
+  [./diff_residual_time]
+    type = PerformanceData
+    category = computeResidual
+    column = total_time
+    event = diff
+  [../]
+  [./diff_jacobian_calls]
+    type = PerformanceData
+    category = computeJacobian
+    column = n_calls
+    event = diff
+  [../]
+  [./right_residual_average_time]
+    type = PerformanceData
+    category = computeResidual
+    column = average_time
+    event = right
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = 'NEWTON'
+[]
+
+[Outputs]
+  [./out]
+    type = CSV
+    object_perf_log = true
+  [../]
+  [./console]
+    type = Console
+    object_perf_log = true
+  [../]
+[]
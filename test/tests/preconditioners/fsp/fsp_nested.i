@@ -0,0 +1,109 @@
+[Mesh]
+  file = square.e
+[]
+
+[Variables]
+  [./u]
+  [../]
+  [./v]
+  [../]
+  [./w]
+  [../]
+[]
+
+[Kernels]
+  [./diff_u]
+    type = Diffusion
+    variable = u
+  [../]
+  [./conv_v]
+    type = CoupledForce
+    variable = v
+    v = u
+  [../]
+  [./diff_v]
+    type = Diffusion
+    variable = v
+  [../]
+  [./diff_w]
+    type = Diffusion
+    variable = w
+  [../]
+[]
+
+[BCs]
+  [./left_u]
+    type = DirichletBC
+    variable = u
+    boundary = 1
+    value = 0
+  [../]
+  [./right_u]
+    type = DirichletBC
+    variable = u
+    boundary = 2
+    value = 100
+  [../]
+  [./left_v]
+    type = DirichletBC
+    variable = v
+    boundary = 1
+    value = 0
+  [../]
+  [./left_w]
+    type = DirichletBC
+    variable = w
+    boundary = 1
+    value = 0
+  [../]
+  [./right_w]
+    type = DirichletBC
+    variable = w
+    boundary = 2
+    value = 1
+  [../]
+[]
+
+[Executioner]
+  # There are no time derivatives, each step solves the problem of fsp_test.i (and w) again
+  type = Transient
+  num_steps = 2
+  dt = 0.5
+[]
+
+[Preconditioning]
+  [./FSP]
+    type = FSP
+    topsplit = 'uvw'
+    [./uvw]
+      # 'uv' is split again below, so the decomposition is a two level tree
+      splitting = 'uv w'
+      splitting_type = multiplicative
+    [../]
+    [./uv]
+      vars = 'u v'
+      splitting = 'u v'
+      splitting_type = multiplicative
+    [../]
+    [./u]
+      vars = 'u'
+      petsc_options_iname = '-pc_type -ksp_type'
+      petsc_options_value = '     hypre preonly'
+    [../]
+    [./v]
+      vars = 'v'
+      petsc_options_iname = '-pc_type -ksp_type'
+      petsc_options_value = '     hypre preonly'
+    [../]
+    [./w]
+      vars = 'w'
+      petsc_options_iname = '-pc_type -ksp_type'
+      petsc_options_value = '     hypre preonly'
+    [../]
+  [../]
+[]
+
+[Outputs]
+  file_base = out
+  exodus = true
+[]
@@ -0,0 +1,84 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  xmin = 0
+  xmax = 1
+  ymin = 0
+  ymax = 1
+  nx = 4
+  ny = 4
+  elem_type = QUAD4
+  uniform_refine = 2
+[]
+
+[Variables]
+  [./u]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+
+  [./v]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+[]
+
+[Preconditioning]
+  [./GMG]
+    type = GMG
+    off_diag_row    = 'u'
+    off_diag_column = 'v'
+  [../]
+[]
+
+[Kernels]
+  [./diff_u]
+    type = Diffusion
+    variable = u
+  [../]
+
+  [./conv_u]
+    type = CoupledForce
+    variable = u
+    v = v
+  [../]
+
+  [./diff_v]
+    type = Diffusion
+    variable = v
+  [../]
+[]
+
+[BCs]
+  [./left_u]
+    type = DirichletBC
+    variable = u
+    boundary = 1
+    value = 1
+  [../]
+
+  [./bottom_v]
+    type = DirichletBC
+    variable = v
+    boundary = 0
+    value = 5
+  [../]
+
+  [./top_v]
+    type = DirichletBC
+    variable = v
+    boundary = 2
+    value = 2
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+
+  # Preconditioned JFNK (default)
+  solve_type = 'PJFNK'
+[]
+
+[Outputs]
+  exodus = true
+[]
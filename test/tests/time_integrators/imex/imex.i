@@ -0,0 +1,84 @@
+# The exact solution is quadratic in time, which the second order method integrates exactly
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  xmin = -1
+  xmax = 1
+  nx = 10
+[]
+
+[Functions]
+  [./forcing_fn]
+    type = ParsedFunction
+    value = 2*t*x
+  [../]
+
+  [./exact_fn]
+    type = ParsedFunction
+    value = t*t*x
+  [../]
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./ie]
+    type = TimeDerivative
+    variable = u
+  [../]
+
+  # Stiff term, solved for
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+
+  # Non-stiff term, only evaluated
+  [./ffn]
+    type = UserForcingFunction
+    variable = u
+    function = forcing_fn
+    implicit = false
+  [../]
+[]
+
+[BCs]
+  [./all]
+    type = FunctionDirichletBC
+    variable = u
+    boundary = 'left right'
+    function = exact_fn
+  [../]
+[]
+
+[Postprocessors]
+  [./l2_err]
+    type = ElementL2Error
+    variable = u
+    function = exact_fn
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+
+  start_time = 0.0
+  num_steps = 5
+  dt = 0.1
+
+  l_tol = 1e-12
+  nl_rel_tol = 1e-12
+  nl_abs_tol = 1e-14
+
+  [./TimeIntegrator]
+    type = IMEXRK2
+  [../]
+[]
+
+[Outputs]
+  csv = true
+[]
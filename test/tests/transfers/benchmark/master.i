@@ -0,0 +1,164 @@
+# Input for scripts/transfer_benchmark.py, which sweeps the mesh size, the number
+# of sub-apps and the number of processors and selects one of the transfers below
+# with "Transfers/active".  The sub-apps all use the master mesh so that every
+# transfer, including MultiAppCopyTransfer, can be used.
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 10
+  ny = 10
+  nz = 10
+  # The MultiAppUserObjectTransfer object only works with ReplicatedMesh
+  parallel_type = replicated
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[UserObjects]
+  [./layered_average]
+    type = LayeredAverage
+    variable = u
+    direction = x
+    num_layers = 10
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 3
+  dt = 1
+  solve_type = 'PJFNK'
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[MultiApps]
+  [./sub]
+    type = TransientMultiApp
+    app_type = MooseTestApp
+    execute_on = timestep_end
+    positions = '0 0 0'
+    input_files = sub.i
+  [../]
+[]
+
+[Transfers]
+  [./copy]
+    type = MultiAppCopyTransfer
+    direction = to_multiapp
+    multi_app = sub
+    source_variable = u
+    variable = from_copy
+  [../]
+  [./mesh_function]
+    type = MultiAppMeshFunctionTransfer
+    direction = to_multiapp
+    multi_app = sub
+    source_variable = u
+    variable = from_mesh_function
+  [../]
+  [./nearest_node]
+    type = MultiAppNearestNodeTransfer
+    direction = to_multiapp
+    multi_app = sub
+    source_variable = u
+    variable = from_nearest_node
+  [../]
+  [./interpolation]
+    type = MultiAppInterpolationTransfer
+    direction = to_multiapp
+    multi_app = sub
+    source_variable = u
+    variable = from_interpolation
+  [../]
+  [./projection]
+    type = MultiAppProjectionTransfer
+    direction = to_multiapp
+    multi_app = sub
+    source_variable = u
+    variable = from_projection
+  [../]
+  [./user_object]
+    type = MultiAppUserObjectTransfer
+    direction = to_multiapp
+    multi_app = sub
+    user_object = layered_average
+    variable = from_user_object
+  [../]
+[]
+
+[Postprocessors]
+  [./copy_time]
+    type = PerformanceData
+    category = Transfers
+    event = copy
+    column = total_time
+  [../]
+  [./mesh_function_time]
+    type = PerformanceData
+    category = Transfers
+    event = mesh_function
+    column = total_time
+  [../]
+  [./nearest_node_time]
+    type = PerformanceData
+    category = Transfers
+    event = nearest_node
+    column = total_time
+  [../]
+  [./interpolation_time]
+    type = PerformanceData
+    category = Transfers
+    event = interpolation
+    column = total_time
+  [../]
+  [./projection_time]
+    type = PerformanceData
+    category = Transfers
+    event = projection
+    column = total_time
+  [../]
+  [./user_object_time]
+    type = PerformanceData
+    category = Transfers
+    event = user_object
+    column = total_time
+  [../]
+  [./transfer_calls]
+    # Set to the active transfer by scripts/transfer_benchmark.py
+    type = PerformanceData
+    category = Transfers
+    event = copy
+    column = n_calls
+  [../]
+[]
+
+[Outputs]
+  csv = true
+[]
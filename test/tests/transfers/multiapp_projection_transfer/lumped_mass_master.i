@@ -0,0 +1,67 @@
+# u = x / 9 is projected with a lumped mass matrix on the sub-app covering [1, 4] x [1, 4]
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  xmin = 0
+  xmax = 9
+  ymin = 0
+  ymax = 9
+  nx = 9
+  ny = 9
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 1
+  dt = 1
+
+  solve_type = 'NEWTON'
+[]
+
+[MultiApps]
+  [./sub]
+    type = TransientMultiApp
+    app_type = MooseTestApp
+    execute_on = timestep_end
+    positions = '1 1 0'
+    input_files = lumped_mass_sub.i
+  [../]
+[]
+
+[Transfers]
+  [./tosub]
+    type = MultiAppProjectionTransfer
+    direction = to_multiapp
+    multi_app = sub
+    source_variable = u
+    variable = u_nodal
+    lumped_mass = true
+  [../]
+[]
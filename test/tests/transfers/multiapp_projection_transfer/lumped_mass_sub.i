@@ -0,0 +1,80 @@
+# The lumped mass projection of the linear u = (x + 1) / 9 keeps its integral (2.5) and its
+# interior nodal values, the boundary nodes get the value at a third of the element: (x + 1/3 + 1) / 9
+# on the left and (x - 1/3 + 1) / 9 on the right.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  xmin = 0
+  xmax = 3
+  ymin = 0
+  ymax = 3
+  nx = 3
+  ny = 3
+[]
+
+[Variables]
+  [./v]
+  [../]
+[]
+
+[AuxVariables]
+  [./u_nodal]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = v
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = v
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = v
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Postprocessors]
+  [./integral]
+    type = ElementIntegralVariablePostprocessor
+    variable = u_nodal
+  [../]
+  [./left]
+    type = PointValue
+    variable = u_nodal
+    point = '0 0 0'
+  [../]
+  [./interior]
+    type = PointValue
+    variable = u_nodal
+    point = '1 1 0'
+  [../]
+  [./right]
+    type = PointValue
+    variable = u_nodal
+    point = '3 0 0'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 1
+  dt = 1
+
+  solve_type = 'NEWTON'
+[]
+
+[Outputs]
+  execute_on = 'timestep_end'
+  csv = true
+[]
@@ -0,0 +1,35 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef BICUBICINTERPOLATIONTEST_H
+#define BICUBICINTERPOLATIONTEST_H
+
+//CPPUnit includes
+#include "GuardedHelperMacros.h"
+
+class BicubicInterpolationTest : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE( BicubicInterpolationTest );
+
+  CPPUNIT_TEST( bilinearData );
+  CPPUNIT_TEST( smoothData );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void bilinearData();
+  void smoothData();
+};
+
+#endif  // BICUBICINTERPOLATIONTEST_H
@@ -0,0 +1,52 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef BILINEARINTERPOLATIONTEST_H
+#define BILINEARINTERPOLATIONTEST_H
+
+//CPPUnit includes
+#include "GuardedHelperMacros.h"
+
+class BilinearInterpolation;
+
+class BilinearInterpolationTest : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE( BilinearInterpolationTest );
+
+  CPPUNIT_TEST( sample );
+  CPPUNIT_TEST( sampleHint );
+  CPPUNIT_TEST( sampleVector );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void setUp();
+  void tearDown();
+
+  void sample();
+  void sampleHint();
+  void sampleVector();
+
+private:
+  /// The bilinear function on the grid, which the interpolation reproduces exactly
+  static double f(double x, double y);
+
+  /// Non-uniform x axis and uniform y axis
+  BilinearInterpolation * _interp;
+
+  static const double _tol;
+};
+
+#endif  // BILINEARINTERPOLATIONTEST_H
@@ -0,0 +1,38 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef BINNEDREDUCTIONTEST_H
+#define BINNEDREDUCTIONTEST_H
+
+//CPPUnit includes
+#include "GuardedHelperMacros.h"
+
+// Moose includes
+#include "BinnedReduction.h"
+
+class BinnedReductionTest : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE( BinnedReductionTest );
+
+  CPPUNIT_TEST( bins );
+  CPPUNIT_TEST( accumulate );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void bins();
+  void accumulate();
+};
+
+#endif  // BINNEDREDUCTIONTEST_H
@@ -0,0 +1,38 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef DEFERREDREDUCTIONTEST_H
+#define DEFERREDREDUCTIONTEST_H
+
+//CPPUnit includes
+#include "GuardedHelperMacros.h"
+
+// Moose includes
+#include "DeferredReduction.h"
+
+class DeferredReductionTest : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE( DeferredReductionTest );
+
+  CPPUNIT_TEST( immediate );
+  CPPUNIT_TEST( twoPasses );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void immediate();
+  void twoPasses();
+};
+
+#endif  // DEFERREDREDUCTIONTEST_H
@@ -0,0 +1,39 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef DUALNUMBERTEST_H
+#define DUALNUMBERTEST_H
+
+//CPPUnit includes
+#include "GuardedHelperMacros.h"
+
+class DualNumberTest : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE( DualNumberTest );
+
+  CPPUNIT_TEST( seed );
+  CPPUNIT_TEST( arithmetic );
+  CPPUNIT_TEST( functions );
+  CPPUNIT_TEST( comparisons );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void seed();
+  void arithmetic();
+  void functions();
+  void comparisons();
+};
+
+#endif  // DUALNUMBERTEST_H
@@ -25,6 +25,8 @@ class LinearInterpolationTest : public CppUnit::TestFixture
   CPPUNIT_TEST( constructor );
   CPPUNIT_TEST( sample );
   CPPUNIT_TEST( getSampleSize );
+  CPPUNIT_TEST( sampleHint );
+  CPPUNIT_TEST( sampleVector );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -35,6 +37,8 @@ public:
   void constructor();
   void sample();
   void getSampleSize();
+  void sampleHint();
+  void sampleVector();
 
 private:
   std::vector<double> * _x;
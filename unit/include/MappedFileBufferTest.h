@@ -0,0 +1,35 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef MAPPEDFILEBUFFERTEST_H
+#define MAPPEDFILEBUFFERTEST_H
+
+//CPPUnit includes
+#include "GuardedHelperMacros.h"
+
+class MappedFileBufferTest : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE(MappedFileBufferTest);
+  CPPUNIT_TEST(readAndSeek);
+  CPPUNIT_TEST(vectorBlock);
+  CPPUNIT_TEST(missingFile);
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void readAndSeek();
+  void vectorBlock();
+  void missingFile();
+};
+
+#endif  // MAPPEDFILEBUFFERTEST_H
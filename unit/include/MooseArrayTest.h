@@ -35,6 +35,8 @@ class MooseArrayTest : public CppUnit::TestFixture
   CPPUNIT_TEST( shallowCopyStdVector );
   CPPUNIT_TEST( operatorEqualsStdVector );
   CPPUNIT_TEST( stdVector );
+  CPPUNIT_TEST( alignment );
+  CPPUNIT_TEST( capacity );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -55,6 +57,8 @@ public:
   void shallowCopyStdVector();
   void operatorEqualsStdVector();
   void stdVector();
+  void alignment();
+  void capacity();
 
 private:
 };
@@ -0,0 +1,40 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef PICARDACCELERATIONTEST_H
+#define PICARDACCELERATIONTEST_H
+
+//CPPUnit includes
+#include "GuardedHelperMacros.h"
+
+// Moose includes
+#include "PicardAcceleration.h"
+
+class PicardAccelerationTest : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE( PicardAccelerationTest );
+
+  CPPUNIT_TEST( constant );
+  CPPUNIT_TEST( aitken );
+  CPPUNIT_TEST( anderson );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void constant();
+  void aitken();
+  void anderson();
+};
+
+#endif  // PICARDACCELERATIONTEST_H
@@ -0,0 +1,41 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef RANKTWOEIGENBENCHMARK_H
+#define RANKTWOEIGENBENCHMARK_H
+
+//CPPUnit includes
+#include "GuardedHelperMacros.h"
+
+/**
+ * Microbenchmark comparing the LAPACK and the batched Jacobi symmetric eigen solvers of
+ * RankTwoTensor.
+ *
+ * This is registered in the "Benchmarks" suite, which is only run with "--benchmarks":
+ *
+ *   ./run_tests --benchmarks
+ */
+class RankTwoEigenBenchmark : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE( RankTwoEigenBenchmark );
+
+  CPPUNIT_TEST( jacobiEigen );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void jacobiEigen();
+};
+
+#endif // RANKTWOEIGENBENCHMARK_H
@@ -33,6 +33,9 @@ class RankTwoEigenRoutinesTest : public CppUnit::TestFixture
 
   CPPUNIT_TEST( someIdentitiesTest );
 
+  CPPUNIT_TEST( jacobiEigenTest );
+  CPPUNIT_TEST( jacobiEigenBatchTest );
+
   CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -46,7 +49,13 @@ public:
 
   void someIdentitiesTest();
 
+  void jacobiEigenTest();
+  void jacobiEigenBatchTest();
+
  private:
+  /// Checks the Jacobi eigen solution of m against the LAPACK one
+  void checkJacobi(const RankTwoTensor & m);
+
   RankTwoTensor _m0;
   RankTwoTensor _m1;
   RankTwoTensor _m2;
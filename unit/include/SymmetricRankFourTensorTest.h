@@ -0,0 +1,51 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef SYMMETRICRANKFOURTENSORTEST_H
+#define SYMMETRICRANKFOURTENSORTEST_H
+
+//CPPUnit includes
+#include "GuardedHelperMacros.h"
+
+// Moose includes
+#include "RankFourTensor.h"
+#include "SymmetricRankFourTensor.h"
+
+class SymmetricRankFourTensorTest : public CppUnit::TestFixture
+{
+
+  CPPUNIT_TEST_SUITE( SymmetricRankFourTensorTest );
+
+  CPPUNIT_TEST( conversionTest );
+  CPPUNIT_TEST( contractionTest );
+  CPPUNIT_TEST( normTest );
+  CPPUNIT_TEST( rotateTest );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  SymmetricRankFourTensorTest();
+  ~SymmetricRankFourTensorTest();
+
+  void conversionTest();
+  void contractionTest();
+  void normTest();
+  void rotateTest();
+
+ private:
+  /// Fully anisotropic tensor with minor and major symmetry
+  RankFourTensor _c;
+};
+
+#endif  // SYMMETRICRANKFOURTENSORTEST_H
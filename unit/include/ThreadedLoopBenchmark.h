@@ -0,0 +1,67 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef THREADEDLOOPBENCHMARK_H
+#define THREADEDLOOPBENCHMARK_H
+
+//CPPUnit includes
+#include "GuardedHelperMacros.h"
+
+// Forward declarations
+class MooseMesh;
+class FEProblem;
+class Factory;
+class MooseApp;
+
+/**
+ * Thread scaling microbenchmarks of ThreadedElementLoop and ThreadedNodeLoop.
+ *
+ * Synthetic loops of increasing cost per element (or node) are run over a
+ * generated mesh, once in the main thread and once with Threads::parallel_reduce,
+ * and a table with the parallel efficiency, the number of splits and the time
+ * spent in the splitting constructors and in join() is printed.  Another loop
+ * looks up a Function through FEProblem::getFunction() for every element to
+ * show the contention on its mutex.
+ *
+ * These are registered in the "Benchmarks" suite, which is only run with
+ * "--benchmarks"; run with --n-threads=1,2,... to see the scaling:
+ *
+ *   ./run_tests --benchmarks --n-threads=4
+ */
+class ThreadedLoopBenchmark : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE( ThreadedLoopBenchmark );
+
+  CPPUNIT_TEST( elementLoop );
+  CPPUNIT_TEST( nodeLoop );
+  CPPUNIT_TEST( getFunction );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void setUp();
+  void tearDown();
+
+  void elementLoop();
+  void nodeLoop();
+  void getFunction();
+
+protected:
+  MooseApp * _app;
+  Factory * _factory;
+  MooseMesh * _mesh;
+  FEProblem * _fe_problem;
+};
+
+#endif // THREADEDLOOPBENCHMARK_H